@@ -0,0 +1,40 @@
+#include "benchmark.hpp"
+#include <cstdio>
+
+namespace Bench
+{
+    bool Matches(const std::string& Name, const std::string& Filter)
+    {
+        return Filter.empty() || Name.find(Filter) != std::string::npos;
+    }
+
+    // One block per benchmark, sizes in the order they ran. The last column is the cost per
+    // operation relative to the smallest world, so a flat 1.00x means the path doesn't scale with size.
+    void Report(const std::vector<Result>& Results)
+    {
+        std::vector<std::string> Names{};
+        for (auto& Entry:Results) {
+            if (std::find(Names.begin(), Names.end(), Entry.Name) == Names.end()) {
+                Names.push_back(Entry.Name);
+            }
+        }
+
+        std::printf("%-44s %10s %14s %10s\n", "Benchmark", "Size", "ns/op", "Scaling");
+
+        for (auto& Name:Names) {
+            double Baseline{};
+
+            for (auto& Entry:Results) {
+                if (Entry.Name != Name) {
+                    continue;
+                }
+                if (Baseline == 0.0) {
+                    Baseline = Entry.NsPerOp;
+                }
+                std::printf("%-44s %10i %14.2f %9.2fx\n", Entry.Name.c_str(), Entry.Size, Entry.NsPerOp,
+                            Baseline > 0.0 ? Entry.NsPerOp / Baseline : 0.0);
+            }
+            std::printf("\n");
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+    struct Result
+    {
+        std::string Name{};
+        int Size{};
+        double NsPerOp{};
+    };
+
+    // Written to after every run so the compiler can't drop the work being timed
+    inline volatile float Sink{};
+
+    constexpr int MinRuns{3};
+    constexpr int MaxRuns{1000};
+    constexpr double MinSeconds{0.2};
+
+    // Calls Body, which performs Ops operations, until MinSeconds have passed and returns the
+    // fastest run in nanoseconds per operation. Reset runs untimed before every run, for bodies
+    // that move what they measure.
+    template <typename Function, typename ResetFunction>
+    double Measure(const long Ops, Function&& Body, ResetFunction&& Reset)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        double Best{std::numeric_limits<double>::max()};
+        double Total{};
+
+        for (int Runs = 0; Runs < MinRuns || (Total < MinSeconds && Runs < MaxRuns); ++Runs) {
+            Reset();
+            auto Start{Clock::now()};
+            Body();
+            std::chrono::duration<double> Elapsed{Clock::now() - Start};
+
+            Best = std::min(Best, Elapsed.count());
+            Total += Elapsed.count();
+        }
+        return Best * 1e9 / static_cast<double>(Ops);
+    }
+
+    template <typename Function>
+    double Measure(const long Ops, Function&& Body)
+    {
+        return Measure(Ops, Body, []() {});
+    }
+
+    bool Matches(const std::string& Name, const std::string& Filter);
+    void Report(const std::vector<Result>& Results);
+}
+
+#endif // BENCHMARK_HPP
@@ -0,0 +1,323 @@
+#include "benchmark.hpp"
+#include "game.hpp"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string_view>
+
+namespace
+{
+    constexpr float Spacing{64.f};      // One prop and one enemy per Spacing x Spacing pixels at every size
+    constexpr int Samples{256};         // Positions per run for the benchmarks that query around a point
+    constexpr float Step{1.f/144.f};
+    constexpr int SeparationCount{5000};    // Enemies in the separation layout comparison
+
+    // Everything game objects keep references to. Loaded headless, so textures only carry their size.
+    struct Assets
+    {
+        Window Screen{1280, 720};
+        GameTexture Textures{};
+        GameAudio Audio{};
+        Background Map{Textures, Audio};
+        Randomizer RandomEngine{};
+
+        Assets() {Textures.Atlas.Build();}
+    };
+
+    // Count props and Count enemies scattered over a square world that grows with Count, so the
+    // neighbourhood of any point looks the same at every size and only the totals change
+    struct World
+    {
+        World(const int Count, Assets& Assets);
+        World(const World&) = delete;
+        World& operator=(const World&) = delete;
+
+        Vector2 Size{};
+        Props Container{{}, {}};
+        std::vector<Prop> Trees{};
+        std::vector<Enemy> Enemies{};
+        std::vector<Sprite> Sprites{};
+        std::vector<Vector2> Positions{};
+        std::vector<Vector2> EnemyStart{};
+    };
+
+    World::World(const int Count, Assets& Assets)
+    {
+        float Side{std::ceil(std::sqrt(static_cast<float>(Count))) * Spacing};
+        Size = Vector2{Side, Side};
+
+        // Fixed seed so every run and every build measures the same layout
+        std::mt19937 Engine{1234u};
+        std::uniform_real_distribution<float> Coordinate{0.f, Side};
+        auto RandomPos = [&]() { return Vector2{Coordinate(Engine), Coordinate(Engine)}; };
+
+        // Half rocks and a quarter bushes end up in the static mask, the grass in the collision grid
+        std::vector<Prop> Scenery{};
+        Scenery.reserve(Count);
+        for (int Index = 0; Index < Count; ++Index) {
+            switch (Index % 4)
+            {
+                case 0:
+                case 1:
+                    Scenery.emplace_back(Assets.Textures.MediumRocks, RandomPos(), PropType::ROCK, Assets.Textures, Assets.Audio);
+                    break;
+                case 2:
+                    Scenery.emplace_back(Assets.Textures.Bush, RandomPos(), PropType::BUSH, Assets.Textures, Assets.Audio);
+                    break;
+                default:
+                    Scenery.emplace_back(Sprite{Assets.Textures.GrassAnimation, 4, 1, 1.f/3.f}, RandomPos(), PropType::GRASS,
+                                         Assets.Textures, Assets.Audio, Assets.Textures.Placeholder, 4.f, true);
+                    break;
+            }
+        }
+        Container.Under.push_back(std::move(Scenery));
+        Container.BuildGrids(Trees, Size);
+
+        Enemies.reserve(Count);
+        for (int Index = 0; Index < Count; ++Index) {
+            Enemies.emplace_back(
+                Sprite{Assets.Textures.BearBrownIdle, 4, 4},
+                Sprite{Assets.Textures.BearBrownWalk, 4, 4},
+                Sprite{Assets.Textures.BearBrownAttack, 4, 4},
+                Sprite{Assets.Textures.BearBrownHurt, 1, 4},
+                Sprite{Assets.Textures.BearBrownDeath, 11, 4},
+                Sprite{Assets.Textures.Placeholder, 0, 0},
+                EnemyType::BEAR, EnemyType::NORMAL, RandomPos(), Assets.Screen, Assets.Map, Assets.Textures, Assets.Audio, Assets.RandomEngine
+            );
+            EnemyStart.push_back(Enemies.back().GetWorldPos());
+        }
+
+        Sprites.reserve(Count);
+        for (int Index = 0; Index < Count; ++Index) {
+            Sprites.emplace_back(Assets.Textures.FoxWalk, 4, 4);
+        }
+
+        for (int Index = 0; Index < Samples; ++Index) {
+            Positions.push_back(RandomPos());
+        }
+    }
+
+    // The pairwise scan separation did before EnemyHotState: every other enemy read straight out
+    // of its Enemy object. Returns the push instead of applying it, with a normal enemy's range and speed.
+    Vector2 SeparateByWalk(const Enemy& Self, const std::vector<Enemy>& Enemies)
+    {
+        constexpr float MinRange{60.f};
+        constexpr float Speed{1.4f};
+        Vector2 RadiusAroundEnemy{5.f,5.f};
+        Vector2 Push{};
+
+        for (auto& Other:Enemies) {
+            if (&Self != &Other && Self.GetType() != EnemyType::BOSS && Other.GetType() != EnemyType::BOSS && !Self.IsDying()) {
+                Vector2 ToOther{Vector2Subtract(Vector2Add(Other.GetEnemyPos(), RadiusAroundEnemy), Self.GetEnemyPos())};
+                if (Vector2Length(ToOther) <= MinRange) {
+                    Push = Vector2Add(Push, Vector2Scale(Vector2Normalize(ToOther), Speed));
+                }
+            }
+        }
+        return Push;
+    }
+
+    // Separation of SeparationCount enemies, the old walk over the Enemy objects against the
+    // cell-sorted arrays. The hot state is built once outside the timing, this is about layout.
+    void RunSeparation(Assets& Assets, const std::string& Filter, std::vector<Bench::Result>& Results)
+    {
+        World Synthetic{SeparationCount, Assets};
+        Vector2 HeroWorldPos{Vector2Scale(Synthetic.Size, 0.5f)};
+
+        for (auto& Enemy:Synthetic.Enemies) {
+            Enemy.UpdateScreenPos(HeroWorldPos);
+        }
+
+        EnemyHotState State{Synthetic.Size};
+        State.Build(Synthetic.Enemies);
+
+        auto Restore = [&]() {
+            for (std::size_t Index = 0; Index < Synthetic.Enemies.size(); ++Index) {
+                Synthetic.Enemies[Index].SetWorldPos(Synthetic.EnemyStart[Index]);
+            }
+        };
+
+        auto Run = [&](const std::string& Name, auto&& Body) {
+            if (Bench::Matches(Name, Filter)) {
+                Results.push_back(Bench::Result{Name, SeparationCount, Bench::Measure(SeparationCount, Body, Restore)});
+            }
+        };
+
+        Run("Separation (std::vector<Enemy> walk)", [&]() {
+            float Sum{};
+            for (auto& Enemy:Synthetic.Enemies) {
+                Sum += SeparateByWalk(Enemy, Synthetic.Enemies).x;
+            }
+            Bench::Sink = Sum;
+        });
+
+        Run("Separation (EnemyHotState)", [&]() {
+            for (auto& Enemy:Synthetic.Enemies) {
+                Enemy.CheckSeparation(State);
+            }
+            Bench::Sink = Synthetic.Enemies.front().GetWorldPos().x;
+        });
+    }
+
+    void RunWorld(const int Count, Assets& Assets, const std::string& Filter, std::vector<Bench::Result>& Results)
+    {
+        World Synthetic{Count, Assets};
+        Character Fox{
+            Sprite{Assets.Textures.FoxIdle, 4, 4},
+            Sprite{Assets.Textures.FoxWalk, 4, 4},
+            Sprite{Assets.Textures.FoxRun, 4, 4},
+            Sprite{Assets.Textures.FoxMelee, 4, 4},
+            Sprite{Assets.Textures.FoxHit, 2, 4},
+            Sprite{Assets.Textures.FoxDie, 1, 4},
+            Sprite{Assets.Textures.FoxPush, 4, 4},
+            Sprite{Assets.Textures.FoxSleeping, 4, 1},
+            Sprite{Assets.Textures.FoxItemGot, 1, 4},
+            Assets.Textures, Assets.Audio, Assets.Screen, Assets.Map
+        };
+        Vector2 HeroWorldPos{Vector2Scale(Synthetic.Size, 0.5f)};
+        auto& Scenery{Synthetic.Container.Under.front()};
+
+        for (auto& Enemy:Synthetic.Enemies) {
+            Enemy.UpdateScreenPos(HeroWorldPos);
+        }
+
+        // Collision and separation push enemies around, so every run starts from the same layout.
+        // Collision also queues touched grass for Apply(), which never runs here.
+        auto Restore = [&]() {
+            for (std::size_t Index = 0; Index < Synthetic.Enemies.size(); ++Index) {
+                Synthetic.Enemies[Index].SetWorldPos(Synthetic.EnemyStart[Index]);
+                Synthetic.Enemies[Index].ClearRequests();
+            }
+        };
+
+        auto Run = [&](const std::string& Name, const long Ops, auto&& Body) {
+            if (Bench::Matches(Name, Filter)) {
+                Results.push_back(Bench::Result{Name, Count, Bench::Measure(Ops, Body, Restore)});
+            }
+        };
+
+        Run("Prop::GetCollisionRec", Count, [&]() {
+            float Sum{};
+            for (auto& Prop:Scenery) {
+                Sum += Prop.GetCollisionRec(HeroWorldPos).x;
+            }
+            Bench::Sink = Sum;
+        });
+
+        // Mask test plus both grid passes, the way the fox checks collision every frame
+        Run("Character::CheckCollision", Samples, [&]() {
+            for (auto Position:Synthetic.Positions) {
+                Fox.SetWorldPos(Position);
+                Fox.CheckMovement(Synthetic.Container, Synthetic.Enemies);
+            }
+            Bench::Sink = Fox.GetWorldPos().x;
+        });
+
+        // Prop and tree steering only, enemies push each other apart in CheckSeparation
+        Run("Enemy::CheckCollision", Samples, [&]() {
+            for (int Index = 0; Index < Samples && Index < Count; ++Index) {
+                Synthetic.Enemies[Index].CheckCollision(Synthetic.Container, HeroWorldPos);
+            }
+            Bench::Sink = Synthetic.Enemies.front().GetWorldPos().x;
+        });
+
+        // The per-frame broadphase rebuild plus every enemy separating against it
+        EnemyHotState State{Synthetic.Size};
+        Run("Enemy::CheckSeparation", Count, [&]() {
+            State.Build(Synthetic.Enemies);
+            for (auto& Enemy:Synthetic.Enemies) {
+                Enemy.CheckSeparation(State);
+            }
+            Bench::Sink = Synthetic.Enemies.front().GetWorldPos().x;
+        });
+
+        // One forest step of enemy updates as ForestUpdate runs it on a single thread. Only what the
+        // scheduler lets through does real work, the rest is classified and skipped. Stepping from
+        // far outside the world leaves only that sweep, the floor every step pays per enemy.
+        UpdateScheduler Scheduler{};
+        GameEvents Events{};
+        auto UpdateStep = [&](const Vector2 CharacterWorldPos) {
+            State.Build(Synthetic.Enemies);
+            Scheduler.BeginStep(CharacterWorldPos);
+            for (std::size_t Index = 0; Index < Synthetic.Enemies.size(); ++Index) {
+                auto& Enemy{Synthetic.Enemies[Index]};
+                Enemy.Think(Step, Scheduler.GetSteps(Enemy.GetWorldPos(), static_cast<int>(Index)), Synthetic.Container, HeroWorldPos, Fox.GetCharPos(), State);
+                Enemy.Apply(HeroWorldPos, Events);
+            }
+            Events.Clear();
+            Bench::Sink = Synthetic.Enemies.front().GetWorldPos().x;
+        };
+        Run("Enemy update step", 1, [&]() { UpdateStep(HeroWorldPos); });
+        Run("Enemy update step (all far)", 1, [&]() { UpdateStep(Vector2{-Synthetic.Size.x * 2.f, -Synthetic.Size.y * 2.f}); });
+
+        Run("Enemy::EnemyAggro", Count, [&]() {
+            for (auto& Enemy:Synthetic.Enemies) {
+                Enemy.EnemyAggro(Fox.GetCharPos());
+            }
+            Bench::Sink = Synthetic.Enemies.front().GetWorldPos().x;
+        });
+
+        Run("Sprite::Tick", Count, [&]() {
+            for (auto& Sprite:Synthetic.Sprites) {
+                Sprite.Tick(Step);
+            }
+            Bench::Sink = static_cast<float>(Synthetic.Sprites.front().FrameX);
+        });
+
+        // What ForestDraw does before drawing a layer, against the full scan it replaced
+        Run("VisibleSet::Update", Samples, [&]() {
+            std::size_t Shown{};
+            for (auto Position:Synthetic.Positions) {
+                Shown += Synthetic.Container.UnderVisible.Update(Position).size();
+            }
+            Bench::Sink = static_cast<float>(Shown);
+        });
+
+        Run("Prop::CheckVisibility (full scan)", Samples, [&]() {
+            for (auto Position:Synthetic.Positions) {
+                for (auto& Prop:Scenery) {
+                    Prop.CheckVisibility(Position);
+                }
+            }
+            Bench::Sink = Scenery.front().GetWorldPos().x;
+        });
+    }
+}
+
+// CryptexBench [filter] [--quick]
+// Runs every benchmark whose name contains filter over 1k, 10k and 100k object worlds (--quick skips 100k),
+// then the separation layout comparison on its own 5k enemy world.
+// Run it from the build directory so the sprites resolve, and from an optimised build.
+int main(int argc, char* argv[])
+{
+    std::string Filter{};
+    bool Quick{false};
+
+    for (int Arg = 1; Arg < argc; ++Arg) {
+        if (std::string_view{argv[Arg]} == "--quick") {
+            Quick = true;
+        }
+        else {
+            Filter = argv[Arg];
+        }
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    Platform::SetHeadless(1280, 720, Step);
+
+    Assets Assets{};
+    std::vector<Bench::Result> Results{};
+
+    for (int Count:{1000, 10000, 100000}) {
+        if (Quick && Count > 10000) {
+            break;
+        }
+        std::fprintf(stderr, "Running %i object world...\n", Count);
+        RunWorld(Count, Assets, Filter, Results);
+    }
+
+    std::fprintf(stderr, "Running %i enemy separation world...\n", SeparationCount);
+    RunSeparation(Assets, Filter, Results);
+
+    Bench::Report(Results);
+}
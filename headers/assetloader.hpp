@@ -0,0 +1,44 @@
+#ifndef ASSETLOADER_HPP
+#define ASSETLOADER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Worker threads for the CPU half of asset loading: reading files and decoding them. Jobs must
+// not touch the GPU or the audio device, those calls stay on the main thread once Wait() returns.
+class AssetLoader
+{
+public:
+    explicit AssetLoader(const int Threads = GetDefaultThreads());
+    ~AssetLoader();
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    void Submit(std::function<void()> Job);
+    void Wait();
+
+    bool IsDone() const {return Finished.load() == Submitted.load();}
+    float GetProgress() const;
+
+    // Leaves one core for the main thread, which keeps drawing the loading screen
+    static int GetDefaultThreads();
+
+private:
+    void Work();
+
+    std::vector<std::thread> Workers{};
+    std::deque<std::function<void()>> Jobs{};
+    std::mutex Lock{};
+    std::condition_variable Wake{};
+    std::condition_variable Idle{};
+    std::atomic<int> Submitted{};
+    std::atomic<int> Finished{};
+    bool Stopping{false};
+};
+
+#endif // ASSETLOADER_HPP
@@ -15,6 +15,8 @@ enum class Area
     FOREST, DUNGEON
 };
 
+class Residency;
+
 class Background
 {
 public:
@@ -29,7 +31,9 @@ public:
     void DrawForest();
     void DrawDungeon();
     void DrawMiniMap(const Vector2 CharWorldPos);
-    void SetArea(const Area& NextMap) {Map = NextMap;}
+    void SetArea(const Area& NextMap);
+    void FinishAreaChange();
+    void SetResidency(Residency* Input) {Areas = Input;}
     Vector2 GetForestMapSize();
     Vector2 GetDungeonMapSize();
     constexpr Vector2 GetMapPos() const {return MapPos;}
@@ -38,12 +42,17 @@ public:
     constexpr float GetScale() const {return Scale;}
     
 private:
+    Rectangle GetView() const;
+
+    static constexpr float CullMargin{64.f};    // Game::MaxInterpolation
+
     const GameTexture& GameTextures;
     const GameAudio& Audio;
     Vector2 MapPos{0.f, 0.f};
     float Scale{4.f};
     Area Map{Area::FOREST};
     bool MiniMapOpen{false};
+    Residency* Areas{nullptr};          // Null in headless runs, which keep every area loaded
 };
 
 #endif // BACKGROUND_HPP
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef BAKEDLAYER_HPP
+#define BAKEDLAYER_HPP
+
+#include <raylib.h>
+#include <vector>
+#include "renderqueue.hpp"
+
+class Prop;
+
+// Static scenery of one draw layer composited into ChunkSize x ChunkSize render textures, so
+// drawing it costs a few blits around the camera instead of one draw per prop. A chunk is only
+// baked again when something in it changes, currently a baked boulder getting pushed away.
+//
+// Props still drawn one by one split the layer in two: what no earlier live prop overlaps goes
+// beneath them, what no later one overlaps goes above them. The layer is submitted as
+// DrawBeneath(), the remaining props in their usual order, then DrawAbove().
+class BakedLayer
+{
+public:
+    BakedLayer() = default;
+    ~BakedLayer();
+    BakedLayer(const BakedLayer&) = delete;
+    BakedLayer& operator=(const BakedLayer&) = delete;
+    BakedLayer(BakedLayer&&) = default;
+
+    void Build(std::vector<std::vector<Prop>>& Layer, const Vector2 WorldSize);
+    void Clear();
+
+    // Refresh switches render targets, so it has to run outside BeginMode2D
+    void Refresh(const Vector2 CharacterWorldPos);
+    void DrawBeneath(RenderQueue& Queue, const RenderLayer Layer, const Vector2 CharacterWorldPos) const;
+    void DrawAbove(RenderQueue& Queue, const RenderLayer Layer, const Vector2 CharacterWorldPos) const;
+
+    static constexpr int ChunkSize{512};
+    static constexpr float CullMargin{64.f};    // Game::MaxInterpolation
+
+private:
+    struct Chunk
+    {
+        std::vector<Prop*> Items{};             // Baked props overlapping the chunk, in draw order
+        RenderTexture2D Target{};
+        bool Dirty{true};
+    };
+
+    // Baked props that may still be pushed out of the spot they were baked at
+    struct Resting
+    {
+        Prop* Item{nullptr};
+        Rectangle DrawRec{};
+    };
+
+    void Add(std::vector<Chunk>& Chunks, Prop& Item);
+    void Refresh(std::vector<Chunk>& Chunks, const Rectangle View);
+    void Draw(const std::vector<Chunk>& Chunks, RenderQueue& Queue, const RenderLayer Layer, const Vector2 CharacterWorldPos) const;
+    void Bake(Chunk& Slot, const Vector2 Origin);
+    Rectangle GetView(const Vector2 CharacterWorldPos) const;
+    Rectangle GetChunkRec(const int Index) const;
+
+    int Columns{};
+    int Rows{};
+    std::vector<Chunk> Beneath{};
+    std::vector<Chunk> Above{};
+    std::vector<Resting> Movers{};
+
+    // Movers drawn after every other prop of the layer, drawn once more over the above chunks
+    std::vector<Prop*> Trailing{};
+};
+
+#endif // BAKEDLAYER_HPP
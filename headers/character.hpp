@@ -30,15 +30,15 @@ public:
               const Window& Screen, 
               Background& World);
     
-    void Tick(float DeltaTime, Props& Props, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
-    void Draw();
+    void Tick(float DeltaTime, Props& Props, std::vector<Enemy>& Enemies);
+    void Draw(RenderQueue& Queue, const Vector2 CameraOffset);
     void SpriteTick(float DeltaTime);
     void UpdateScreenPos();
     void CheckDirection();
-    void CheckMovement(Props& Props, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
+    void CheckMovement(Props& Props, std::vector<Enemy>& Enemies);
     void UndoMovement();
     void CheckOutOfBounds();
-    void CheckCollision(std::vector<std::vector<Prop>>& Props, const Vector2 Direction, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
+    void CheckCollision(SpatialGrid<Prop>& Grid, const CollisionMask& Mask, const Vector2 Direction, std::vector<Enemy>& Enemies);
     void CheckCollision(std::vector<Enemy>& Enemies);
     void WalkOrRun();
     void CheckAttack();
@@ -75,6 +75,7 @@ public:
     constexpr Vector2 GetCharPos() const {return ScreenPos;}
     constexpr Emotion GetEmotion() const {return State;}
     Rectangle GetCollisionRec();
+    Rectangle GetWorldCollisionRec();
     Rectangle GetAttackRec();
 
     // Debug function
@@ -0,0 +1,49 @@
+#ifndef COLLISIONMASK_HPP
+#define COLLISIONMASK_HPP
+
+#include <raylib.h>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Occupancy mask of the world at one bit per CellSize x CellSize pixels. Blocking tests
+// only look at the bits under the query rectangle, so they cost the same no matter how
+// many colliders were baked into the map.
+class CollisionMask
+{
+public:
+    CollisionMask() = default;
+    CollisionMask(const Vector2 WorldSize, const int CellSize = 4);
+
+    void Add(const Rectangle Rec);
+    void Clear();
+    bool IsBlocked(const Rectangle Rec) const;
+
+    constexpr int GetCellSize() const {return CellSize;}
+    constexpr int GetColumns() const {return Columns;}
+    constexpr int GetRows() const {return Rows;}
+
+    // Raw cells, so levelc can bake the mask into a level and the game can adopt it again at load
+    const std::vector<std::uint64_t>& GetBits() const {return Bits;}
+    bool Import(std::span<const std::uint64_t> BakedBits);
+
+private:
+    struct Span
+    {
+        int Left{};
+        int Top{};
+        int Right{};
+        int Bottom{};
+    };
+
+    Span GetSpan(const Rectangle Rec) const;
+    void Set(const int X, const int Y);
+
+    int CellSize{4};
+    int Columns{};
+    int Rows{};
+    int WordsPerRow{};
+    std::vector<std::uint64_t> Bits{};
+};
+
+#endif // COLLISIONMASK_HPP
@@ -1,9 +1,11 @@
 #ifndef ENEMY_HPP
 #define ENEMY_HPP
 
+#include <array>
 #include "prop.hpp"
 #include "window.hpp"
 #include "randomizer.hpp"
+#include "gameevents.hpp"
 
 enum class EnemyType 
 {
@@ -24,6 +26,7 @@ enum class NPC
 };
 
 struct Enemies;
+struct EnemyHotState;
 
 class Enemy
 {
@@ -62,27 +65,30 @@ public:
           Randomizer& RandomEngine,
           const float Scale = 3.2f);
 
-    void Tick(float DeltaTime, Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
-    void Draw(const Vector2 HeroWorldPos);
+    void Tick(float DeltaTime, const int Steps, const Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, const EnemyHotState& Enemies, GameEvents& Events);
+    void Think(float DeltaTime, const int Steps, const Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, const EnemyHotState& Enemies);
+    void Apply(const Vector2 HeroWorldPos, GameEvents& Events);
+    void ClearRequests();
+    void Draw(RenderQueue& Queue, const RenderLayer Layer, const Vector2 HeroWorldPos);
     void SpriteTick(float DeltaTime);
     void UpdateScreenPos(Vector2 HeroWorldPos);
     void CheckDirection();
-    void CheckMovement(Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
+    void CheckMovement(const Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, const EnemyHotState& Enemies, const int Steps);
     void NeutralAction();
     void UndoMovement();
     void CheckOutOfBounds();
-    void CheckCollision(std::vector<std::vector<Prop>>& Props, const Vector2 HeroWorldPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
+    void CheckCollision(const Props& Props, const Vector2 HeroWorldPos);
+    void CheckSeparation(const EnemyHotState& Enemies);
     void CheckAttack();
     void UpdateSource();
     void TakeDamage();
     void CheckAlive(float DeltaTime);
-    void EnemyAI();
+    void EnemyAI(const int Steps);
     void EnemyAggro(const Vector2 HeroScreenPos);
-    void CheckMovementAI();
+    void CheckMovementAI(const int Steps);
     void InitializeAI();
-    void DrawHP();
+    void DrawHP(RenderQueue& Queue);
     void CheckBossSummon(const Vector2 HeroWorldPos);
-    void CheckSpawnChest(std::vector<std::vector<Prop>>& Props);
 
     // Audio
     void WalkingAudio();
@@ -102,6 +108,7 @@ public:
     int GetMonstersKilled() {return MonsterDeaths;}
     int GetTotalMonsters() {return MonsterCount;}
     constexpr Vector2 GetWorldPos() const {return WorldPos;}
+    constexpr void SetWorldPos(const Vector2 Pos) {WorldPos = Pos;}
     constexpr Vector2 GetPrevWorldPos() const {return PrevWorldPos;}
     constexpr Vector2 GetEnemyPos() const {return ScreenPos;}
     constexpr EnemyType GetType() const {return Type;}
@@ -111,7 +118,9 @@ public:
     Vector2 UpdateProjectile();
     std::array<Vector2,3> UpdateMultiProjectile();
     bool WithinScreen(const Vector2 HeroWorldPos);
+    void CheckVisibility(const Vector2 HeroWorldPos) {Visible = WithinScreen(HeroWorldPos);}
     int GetMonsterCount(const EnemyType Type) {return MonsterCounter.at(Type);}
+    static ItemId GetBossReward(const EnemyType Race);
     
 private:
     std::vector<Sprite> Sprites{};
@@ -141,12 +150,14 @@ private:
     int MaxHP{};
     int LeftOrRight{};
     int ActionState{};
+    int NextActionState{};
     float Scale{3.2f};
     float Speed{1.4f};
     float Radius{25.f};                 
     float MaxRange{150.f};
     float MinRange{60.f};
     float MinCollisionRange{0.5f};
+    float SeparationMargin{32.f};       // Slack for movement since the hot state was rebuilt
     float RunningTime{};
     float DamageTime{};
     float StopTime{};
@@ -175,6 +186,22 @@ private:
     bool Ranged{false};
     bool Summoned{true};
     bool Visible{false};
+    bool WasAlive{true};                // Alive before the current Think()
+
+    // What Think() leaves for Apply() to do on the main thread
+    struct Requests
+    {
+        std::vector<Prop*> Grass{};     // Set rustling
+        bool RollAction{false};         // NextActionState was used up
+        bool AttackSound{false};
+        bool DamageSound{false};
+        bool DeathSound{false};
+    };
+    Requests Pending{};
+
+    // Reused by CheckCollision() so its grid queries don't allocate once warmed up
+    std::vector<int> QueryScratch{};
+    std::vector<Prop*> Nearby{};
 
     // Wildlife NPC
     bool IdleTwo{false};
@@ -189,6 +216,33 @@ private:
     std::uniform_int_distribution<int> RandomActionState{1,10};
 
     static std::unordered_map<EnemyType, int> MonsterCounter;
+    static const std::unordered_map<EnemyType, ItemId> BossRewards;   // Altar piece each boss race guards
+};
+
+// Per-frame copy of the fields the separation pass reads from other enemies, bucketed by grid cell.
+// Enemies sharing a cell sit next to each other in plain arrays, so scanning neighbours streams a
+// few floats instead of pulling whole Enemy objects through the cache.
+struct EnemyHotState
+{
+    EnemyHotState() = default;
+    EnemyHotState(const Vector2 WorldSize, const float CellSize = 128.f);
+
+    void Build(const std::vector<Enemy>& Enemies);
+    int CellX(const float X) const;
+    int CellY(const float Y) const;
+
+    float CellSize{128.f};
+    int Columns{1};
+    int Rows{1};
+    std::vector<int> CellStart{0, 0};       // Cell c owns entries [CellStart[c], CellStart[c+1])
+    std::vector<float> ScreenX{};
+    std::vector<float> ScreenY{};
+    std::vector<const Enemy*> Owner{};      // Only compared against, never dereferenced
+
+private:
+    // Scratch for the counting sort in Build()
+    std::vector<int> Cells{};
+    std::vector<int> Next{};
 };
 
 #endif // ENEMY_HPP
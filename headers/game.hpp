@@ -2,7 +2,11 @@
 #define GAME_HPP
 
 #include <array>
+#include "assetloader.hpp"
 #include "hud.hpp"
+#include "jobsystem.hpp"
+#include "level.hpp"
+#include "updatescheduler.hpp"
 
 namespace Game 
 {
@@ -11,6 +15,14 @@ namespace Game
         MAINMENU, FOREST, DUNGEON, PAUSED, GAMEOVER, TRANSITION, EXIT
     };
 
+    // Gameplay speeds are tuned per frame at 144 FPS, so the simulation keeps stepping at that rate
+    constexpr float SimulationStep{1.f/144.f};
+    constexpr float MaxFrameTime{0.25f};
+    constexpr float MaxInterpolation{64.f};
+    constexpr const char* TracePath{"cryptex_trace.json"};
+    constexpr const char* LevelPath{"levels/forest.lvl"};
+    constexpr int ThinkBatchSize{4};       // Enemies per job, thinking one is cheap
+
     struct Info
     {
         Background Map;
@@ -33,6 +45,9 @@ namespace Game
         Game::State State{Game::State::TRANSITION};
         Game::State PrevState{Game::State::FOREST};
         Game::State NextState{Game::State::MAINMENU};
+        float Accumulator{0.f};             // Frame time not yet simulated
+        float Alpha{0.f};                   // How far the render sits between the last two steps
+        Vector2 PrevFoxPos{};
 
         // Debugging --------------------
         bool ShowPos{false};
@@ -42,6 +57,7 @@ namespace Game
         bool DevToolsOn{false};
         bool ShowDevTools{true};
         bool DrawRectanglesOn{false};
+        bool ShowProfiler{false};
     };
 
     struct Objects
@@ -53,17 +69,32 @@ namespace Game
         std::vector<Enemy> Crows;
         std::vector<Prop> Trees;
         std::array<Sprite, 5> PauseFox;
-        std::array<const Texture2D, 9> Buttons;
+        std::array<const AtlasTexture, 9> Buttons;
+        EnemyHotState EnemyState{};         // Rebuilt every frame before the enemies tick
+        RenderQueue Queue{};                // Sprites of the frame being drawn
+        UpdateScheduler Scheduler{};        // Activity tiers of enemies and crows
+        GameEvents Events{};                // Published by the update, handled at the end of it
+        JobSystem* Jobs{nullptr};           // Runs enemy thinking in parallel, serial when unset
     };
 
     void Run();
+    void RunHeadless(const int Frames, const std::string& ScriptPath);
     void Initialize(const Window& Window, const std::string& Title);
+    void LoadAssets(AssetLoader& Loader);
+    void LoadingDraw(const float Progress);
     void CheckScreenSizing(Window& Window);
     void Tick(Window& Window, Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures, const GameAudio& Audio);
-    void ForestUpdate(Game::Info& Info, Game::Objects& Objects, const GameAudio& Audio);
+    using UpdateFunction = void (*)(Game::Info&, Game::Objects&, const GameAudio&, const float);
+    void Simulate(Game::Info& Info, Game::Objects& Objects, const GameAudio& Audio, const UpdateFunction Update);
+    Camera2D GetInterpolatedCamera(const Game::Info& Info, const Game::Objects& Objects);
+    void ForestUpdate(Game::Info& Info, Game::Objects& Objects, const GameAudio& Audio, const float DeltaTime);
     void ForestDraw(Game::Info& Info, Game::Objects& Objects);
-    void DungeonUpdate(Game::Info& Info, Game::Objects& Objects, const GameAudio& Audio);
+    void ForestCull(Game::Objects& Objects);
+    void ThinkAll(Game::Objects& Objects, std::vector<Enemy>& Enemies, const float DeltaTime);
+    void HandleEvents(Game::Objects& Objects);
+    void DungeonUpdate(Game::Info& Info, Game::Objects& Objects, const GameAudio& Audio, const float DeltaTime);
     void DungeonDraw(Game::Info& Info, Game::Objects& Objects);
+    void DungeonCull(Game::Objects& Objects);
     void PauseUpdate(Game::Info& Info, Game::Objects& Objects, const GameAudio& Audio);
     void PauseDraw(const Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures);
     void ExitUpdate(Game::Info& Info, const GameAudio& Audio);
@@ -74,17 +105,19 @@ namespace Game
     void GameOverDraw(const Game::Info& Info);
     void Transition(Game::Info& Info, const GameAudio& Audio);
 
+    Game::Objects InitializeObjects(const LevelFile& Level, const Window& Window, Game::Info& Info, const GameTexture& Textures, const GameAudio& Audio, Randomizer& RandomEngine);
     HUD InitializeHud(const GameTexture& Textures);
     Character InitializeFox(const Window& Window, Game::Info& Info, const GameTexture& Textures, const GameAudio& Audio);
     std::array<Sprite,5> InitializePauseFox(const GameTexture& Textures);
-    std::array<const Texture2D,9> InitializeButtons(const GameTexture& Textures);
-    std::vector<std::vector<Prop>> InitializePropsUnder(const GameTexture& Textures, const GameAudio& Audio);
-    std::vector<std::vector<Prop>> InitializePropsOver(const GameTexture& Textures, const GameAudio& Audio);
-    std::vector<Prop> InitializeTrees(const GameTexture& Textures, const GameAudio& Audio);
-    std::vector<Enemy> InitializeEnemies(Background& MapBG, const Window& Window, const GameTexture& Textures, Randomizer& RandomEngine, const GameAudio& Audio);
-    std::vector<Enemy> InitializeCrows(Background& MapaBG, const Window& Window, const GameTexture& Textures, Randomizer& RandomEngine, const GameAudio& Audio);
+    std::array<const AtlasTexture, 9> InitializeButtons(const GameTexture& Textures);
+    std::vector<std::vector<Prop>> InitializePropsUnder(const LevelFile& Level, const GameTexture& Textures, const GameAudio& Audio);
+    std::vector<std::vector<Prop>> InitializePropsOver(const LevelFile& Level, const GameTexture& Textures, const GameAudio& Audio);
+    std::vector<Prop> InitializeTrees(const LevelFile& Level, const GameTexture& Textures, const GameAudio& Audio);
+    std::vector<Enemy> InitializeEnemies(const LevelFile& Level, Background& MapBG, const Window& Window, const GameTexture& Textures, Randomizer& RandomEngine, const GameAudio& Audio);
+    std::vector<Enemy> InitializeCrows(const LevelFile& Level, Background& MapBG, const Window& Window, const GameTexture& Textures, Randomizer& RandomEngine, const GameAudio& Audio);
 
     // Debugging --------------------
+    void DrawProfiler();
     void DrawCollisionRecs(Prop& Prop, const Vector2 CharacterWorldPos, Color RecColor = {0, 121, 241, 150});
     template <typename Object>
     void DrawCollisionRecs(Object& Type, Color RecColor = {0, 238, 135, 150});
@@ -2,6 +2,7 @@
 #define GAMEAUDIO_HPP
 
 #include <raylib.h>
+#include "platform.hpp"
 
 struct GameAudio 
 {
@@ -12,28 +13,33 @@ struct GameAudio
     GameAudio& operator=(const GameAudio&) = delete;
     GameAudio& operator=(GameAudio&&) = default;
     
-    const Sound AltarInsert{LoadSound("audio/AltarInsert.wav")};
-    const Sound BossDeath{LoadSound("audio/BossDeath.wav")};
-    const Sound FoxAttack{LoadSound("audio/Slash.wav")};
-    const Sound FoxAttackTwo{LoadSound("audio/DoubleSlash.wav")};
-    const Sound ImpactHeavy{LoadSound("audio/ImpactHeavy.wav")};
-    const Sound ImpactMedium{LoadSound("audio/ImpactMedium.wav")};
-    const Sound MapChange{LoadSound("audio/MapChange.wav")};
-    const Sound MonsterAttack{LoadSound("audio/MonsterAttack.wav")};
-    const Sound MonsterDeath{LoadSound("audio/MonsterDeath.wav")};
-    const Sound MonsterRangedAttack{LoadSound("audio/MonsterRangedAttack.wav")};
-    const Sound MoveCursor{LoadSound("audio/MoveCursor.wav")};
-    const Sound NpcTalk{LoadSound("audio/NpcTalk.wav")};
-    const Sound Pushing{LoadSound("audio/Push.wav")};
-    const Sound Select{LoadSound("audio/Select.wav")};
-    const Sound Sleep{LoadSound("audio/MiniMap.wav")};
-    const Sound Transition{LoadSound("audio/Transition.wav")};
-    const Sound TreasureOpen{LoadSound("audio/Treasure.wav")};
-    const Sound Walking{LoadSound("audio/Footsteps.wav")};
+    const Sound AltarInsert{Platform::LoadSound("audio/AltarInsert.wav")};
+    const Sound BossDeath{Platform::LoadSound("audio/BossDeath.wav")};
+    const Sound FoxAttack{Platform::LoadSound("audio/Slash.wav")};
+    const Sound FoxAttackTwo{Platform::LoadSound("audio/DoubleSlash.wav")};
+    const Sound ImpactHeavy{Platform::LoadSound("audio/ImpactHeavy.wav")};
+    const Sound ImpactMedium{Platform::LoadSound("audio/ImpactMedium.wav")};
+    const Sound MapChange{Platform::LoadSound("audio/MapChange.wav")};
+    const Sound MonsterAttack{Platform::LoadSound("audio/MonsterAttack.wav")};
+    const Sound MonsterDeath{Platform::LoadSound("audio/MonsterDeath.wav")};
+    const Sound MonsterRangedAttack{Platform::LoadSound("audio/MonsterRangedAttack.wav")};
+    const Sound MoveCursor{Platform::LoadSound("audio/MoveCursor.wav")};
+    const Sound NpcTalk{Platform::LoadSound("audio/NpcTalk.wav")};
+    const Sound Pushing{Platform::LoadSound("audio/Push.wav")};
+    const Sound Select{Platform::LoadSound("audio/Select.wav")};
+    const Sound Sleep{Platform::LoadSound("audio/MiniMap.wav")};
+    const Sound Transition{Platform::LoadSound("audio/Transition.wav")};
+    const Sound TreasureOpen{Platform::LoadSound("audio/Treasure.wav")};
+    const Sound Walking{Platform::LoadSound("audio/Footsteps.wav")};
 
-    Music DungeonTheme{LoadMusicStream("audio/ZealPalace.mp3")};
-    Music ForestTheme{LoadMusicStream("audio/SecretOfTheForest.mp3")};
-    Music PauseMenuTheme{LoadMusicStream("audio/PauseMenuTheme.ogg")};
+    // Area themes are opened by Residency while the player is in their area
+    static constexpr const char* DungeonThemePath{"audio/ZealPalace.mp3"};
+    static constexpr const char* ForestThemePath{"audio/SecretOfTheForest.mp3"};
+    static constexpr float ThemeVolume{0.25f};
+
+    Music DungeonTheme{};
+    Music ForestTheme{};
+    Music PauseMenuTheme{Platform::LoadMusicStream("audio/PauseMenuTheme.ogg")};
 };
 
 
@@ -0,0 +1,32 @@
+#ifndef GAMEEVENTS_HPP
+#define GAMEEVENTS_HPP
+
+#include <cstdint>
+#include <vector>
+
+enum class EnemyType;
+
+enum class GameEventType : std::uint8_t
+{
+    BOSS_DEFEATED
+};
+
+struct GameEvent
+{
+    GameEventType Type{};
+    EnemyType Race{};
+};
+
+// Gameplay happenings published while entities tick, handled once the whole frame has updated
+class GameEvents
+{
+public:
+    void Publish(const GameEvent& Event) {Pending.push_back(Event);}
+    const std::vector<GameEvent>& GetPending() const {return Pending;}
+    void Clear() {Pending.clear();}
+
+private:
+    std::vector<GameEvent> Pending{};
+};
+
+#endif // GAMEEVENTS_HPP
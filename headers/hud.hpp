@@ -13,7 +13,7 @@ public:
     
 private:
     const GameTexture& GameTextures;
-    Texture2D Fox{};
+    AtlasTexture Fox{};
 
     float Scale{2.f};
 };
@@ -0,0 +1,33 @@
+#ifndef ITEMS_HPP
+#define ITEMS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Everything a chest can hold. The altar pieces come first so their id doubles as their index
+// into the altar bitsets.
+enum class ItemId : std::uint8_t
+{
+    TOP_LEFT_ALTAR, TOP_ALTAR, TOP_RIGHT_ALTAR,
+    BOTTOM_LEFT_ALTAR, BOTTOM_ALTAR, BOTTOM_RIGHT_ALTAR,
+    CRYPTEX, SILVER_BRACELET, NONE
+};
+
+constexpr std::size_t AltarPieceCount{6};
+constexpr std::size_t ItemCount{static_cast<std::size_t>(ItemId::NONE) + 1};
+
+// Names shown to the player and written in level sources, in enum order. All are literals, so
+// data() is null-terminated.
+constexpr std::array<std::string_view, ItemCount> ItemNames{
+    "Top Left Altar Piece", "Top Altar Piece", "Top Right Altar Piece",
+    "Bottom Left Altar Piece", "Bottom Altar Piece", "Bottom Right Altar Piece",
+    "Cryptex", "Silver Bracelet", "None"
+};
+
+constexpr std::size_t GetItemIndex(const ItemId Item) {return static_cast<std::size_t>(Item);}
+constexpr bool IsAltarPiece(const ItemId Item) {return GetItemIndex(Item) < AltarPieceCount;}
+constexpr const char* GetItemName(const ItemId Item) {return ItemNames[GetItemIndex(Item)].data();}
+
+#endif // ITEMS_HPP
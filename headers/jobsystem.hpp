@@ -0,0 +1,50 @@
+#ifndef JOBSYSTEM_HPP
+#define JOBSYSTEM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Worker threads for loops whose iterations don't depend on each other. ParallelFor() hands out
+// batches of the range to the workers and the calling thread alike, and returns once all of them
+// have run. Which thread runs a batch varies, so iterations must only write their own data.
+class JobSystem
+{
+public:
+    explicit JobSystem(const int Threads = GetDefaultThreads());
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    void ParallelFor(const int Count, const int BatchSize, const std::function<void(int Begin, int End)>& Body);
+
+    int GetThreads() const {return static_cast<int>(Workers.size()) + 1;}
+
+    // Leaves one core for the main thread, which runs batches of its own
+    static int GetDefaultThreads();
+
+private:
+    void Work();
+    void RunBatches();
+
+    std::vector<std::thread> Workers{};
+    std::mutex Lock{};
+    std::condition_variable Wake{};
+    std::condition_variable Idle{};
+    bool Stopping{false};
+
+    // The loop being run, published to the workers by bumping Generation
+    const std::function<void(int, int)>* Body{nullptr};
+    int Count{};
+    int BatchSize{1};
+    int Batches{};
+    std::atomic<int> NextBatch{};
+    int Busy{};
+    std::uint64_t Generation{};
+};
+
+#endif // JOBSYSTEM_HPP
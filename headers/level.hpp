@@ -0,0 +1,185 @@
+#ifndef LEVEL_HPP
+#define LEVEL_HPP
+
+#include <cstdint>
+#include "enemy.hpp"
+#include "mappedfile.hpp"
+
+// On-disk layout of a level: a header, a string table, then fixed-size prop and enemy records in
+// the order the game constructs them, then the spatial indexes levelc baked for those props.
+// Everything is little-endian and 4-byte aligned (8 for the mask words), so the records are read
+// straight out of the mapped file.
+namespace LevelFormat
+{
+    constexpr std::uint32_t Magic{0x564C5843};          // "CXLV"
+    constexpr std::uint32_t Version{5};
+    constexpr std::uint16_t None{0xFFFF};               // Missing texture or string
+
+    enum class PropLayer : std::uint8_t
+    {
+        UNDER, OVER, TREES
+    };
+
+    // Which Prop constructor builds the record
+    enum class PropKind : std::uint8_t
+    {
+        STATIC, ALTAR, ANIMATED
+    };
+
+    enum class EnemyKind : std::uint8_t
+    {
+        MONSTER, NPC
+    };
+
+    enum class EnemyList : std::uint8_t
+    {
+        ENEMIES, CROWS
+    };
+
+    enum PropFlags : std::uint8_t
+    {
+        MOVEABLE = 1, INTERACTABLE = 2, INVISIBLE = 4, SPAWNED = 8
+    };
+
+    // Which of the Props indexes a baked grid fills
+    enum class GridKind : std::uint8_t
+    {
+        UNDER_COLLISION, OVER_COLLISION, UNDER_VISIBLE, OVER_VISIBLE, TREE_VISIBLE, STATIC_COLLISION
+    };
+    constexpr std::uint32_t GridKindCount{static_cast<std::uint32_t>(GridKind::STATIC_COLLISION) + 1};
+
+    struct Header
+    {
+        std::uint32_t Magic{};
+        std::uint32_t Version{};
+        std::uint32_t StringCount{};
+        std::uint32_t StringOffset{};                   // StringCount offsets into the characters that follow them
+        std::uint32_t PropCount{};
+        std::uint32_t PropOffset{};
+        std::uint32_t EnemyCount{};
+        std::uint32_t EnemyOffset{};
+        float WorldWidth{};                             // World the indexes were baked for
+        float WorldHeight{};
+        std::uint32_t GridCount{};                      // Zero when the level carries no indexes
+        std::uint32_t GridOffset{};
+        std::uint32_t MaskOffset{};
+        std::uint32_t Padding{};
+    };
+
+    struct SpriteRecord
+    {
+        std::uint16_t Texture{None};                    // Strings index of the image path
+        std::uint8_t FramesX{};
+        std::uint8_t FramesY{};
+        float UpdateSpeed{};
+    };
+
+    struct PropRecord
+    {
+        PropLayer Layer{};
+        PropKind Kind{};
+        std::uint8_t Type{};                            // PropType
+        std::uint8_t Flags{};
+        std::uint16_t Group{};                          // Container within the layer, drawn in order
+        std::uint8_t ItemType{static_cast<std::uint8_t>(ItemId::NONE)};
+        std::uint8_t Padding{};
+        SpriteRecord Sprite{};
+        std::uint16_t Item{None};
+        std::uint8_t TriggerAct{};                      // Progress
+        std::uint8_t TriggerNpc{};                      // PropType
+        float X{};
+        float Y{};
+        float Scale{};
+        float ItemScale{};
+    };
+
+    struct EnemyRecord
+    {
+        EnemyKind Kind{};
+        EnemyList List{};
+        std::uint8_t Race{};                            // EnemyType
+        std::uint8_t Type{};
+        std::uint8_t BossSpawner{};
+        std::uint8_t Health{};
+        std::uint16_t Padding{};
+        SpriteRecord Sprites[6]{};                      // Monster order, NPCs use the first five
+        float X{};
+        float Y{};
+        float Scale{};
+    };
+
+    // One SpatialGrid: its entries in registration order, then per cell the entries linked into
+    // it, stored as Columns * Rows + 1 starts into one shared list of entry indexes
+    struct GridRecord
+    {
+        GridKind Kind{};
+        std::uint8_t Padding[3]{};
+        float CellSize{};
+        std::uint32_t Columns{};
+        std::uint32_t Rows{};
+        std::uint32_t EntryCount{};
+        std::uint32_t EntryOffset{};
+        std::uint32_t CellOffset{};
+        std::uint32_t LinkCount{};
+        std::uint32_t LinkOffset{};
+    };
+
+    struct GridEntry
+    {
+        std::uint32_t Prop{};                           // Index of the prop record
+        float X{};
+        float Y{};
+        float Width{};
+        float Height{};
+    };
+
+    // The static collider mask, its words as they sit in memory
+    struct MaskRecord
+    {
+        std::uint32_t CellSize{};
+        std::uint32_t Columns{};
+        std::uint32_t Rows{};
+        std::uint32_t WordCount{};
+        std::uint32_t WordOffset{};
+        std::uint32_t Padding{};
+    };
+
+    static_assert(sizeof(Header) == 56 && sizeof(PropRecord) == 36 && sizeof(EnemyRecord) == 68);
+    static_assert(sizeof(GridRecord) == 36 && sizeof(GridEntry) == 20 && sizeof(MaskRecord) == 24);
+}
+
+// A level file mapped into memory. The records are validated once when the file is opened and
+// the props and enemies they describe are built straight into the game's containers. Every image
+// a record names has to be one of Textures', whose handles the loaded props and enemies keep.
+class LevelFile
+{
+public:
+    LevelFile(const std::string& Path, const GameTexture& Textures);
+
+    bool IsLoaded() const {return Loaded;}
+    std::vector<std::vector<Prop>> LoadProps(const LevelFormat::PropLayer Layer, const GameTexture& Textures, const GameAudio& Audio) const;
+    std::vector<Enemy> LoadEnemies(const LevelFormat::EnemyList List, Background& World, const Window& Screen, const GameTexture& Textures, 
+                                   const GameAudio& Audio, Randomizer& RandomEngine) const;
+    bool LoadIndexes(Props& Container, std::vector<Prop>& Trees, const Vector2 WorldSize) const;
+    std::vector<Prop*> MapProps(Props& Container, std::vector<Prop>& Trees) const;
+
+private:
+    bool Validate(const GameTexture& Textures);
+    bool ValidateIndexes();
+    AtlasTexture GetTexture(const std::uint16_t Index) const;
+    Sprite GetSprite(const LevelFormat::SpriteRecord& Record) const;
+
+    MappedFile File;
+    const LevelFormat::Header* Head{nullptr};
+    const std::uint32_t* StringOffsets{nullptr};
+    const char* Strings{nullptr};
+    std::size_t StringBytes{};
+    const LevelFormat::PropRecord* PropRecords{nullptr};
+    const LevelFormat::EnemyRecord* EnemyRecords{nullptr};
+    const LevelFormat::GridRecord* Grids{nullptr};
+    const LevelFormat::MaskRecord* Mask{nullptr};
+    std::vector<AtlasTexture> Resolved{};   // Per string, empty for strings no image record uses
+    bool Loaded{false};
+};
+
+#endif // LEVEL_HPP
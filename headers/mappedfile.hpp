@@ -0,0 +1,29 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+
+// A read-only view of a whole file mapped into memory. Pages are read in by the OS as they are
+// touched, so nothing is copied up front. Empty when the file could not be opened or mapped.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& Path);
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const unsigned char* GetData() const {return Data;}
+    std::size_t GetSize() const {return Size;}
+
+private:
+    const unsigned char* Data{nullptr};
+    std::size_t Size{};
+#ifdef _WIN32
+    void* File{nullptr};
+    void* Mapping{nullptr};
+#endif
+};
+
+#endif // MAPPEDFILE_HPP
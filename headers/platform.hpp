@@ -0,0 +1,48 @@
+#ifndef PLATFORM_HPP
+#define PLATFORM_HPP
+
+#include <raylib.h>
+#include "assetloader.hpp"
+#include <string>
+
+// Thin layer between the game and raylib's window, input and asset loading. Normal runs
+// forward straight to raylib. Headless runs have no window, GPU or audio device: input is
+// replayed from a script, frames advance by a fixed step and textures only carry their size
+// so collision shapes still line up with the real game.
+namespace Platform
+{
+    void SetHeadless(const int ScreenWidth, const int ScreenHeight, const float FrameTime);
+    bool IsHeadless();
+    bool LoadInputScript(const std::string& Path);
+    void NextFrame();
+    int GetFrame();
+
+    // Fixed-step simulation. BeginFrame() runs once per rendered frame and latches presses, so a
+    // press is seen by exactly one simulation step even when a frame runs zero or several steps.
+    // Between BeginStep() and EndStep() GetFrameTime() reports the step length.
+    void BeginFrame();
+    void BeginStep(const float Step);
+    void EndStep();
+
+    // Input
+    bool IsKeyDown(const int Key);
+    bool IsKeyPressed(const int Key);
+    bool IsKeyReleased(const int Key);
+    bool IsMouseButtonDown(const int Button);
+    bool IsMouseButtonPressed(const int Button);
+
+    // Window
+    int GetScreenWidth();
+    int GetScreenHeight();
+    float GetFrameTime();
+
+    // Assets. PrefetchSounds() decodes every .wav in Directory on the loader's workers, and once
+    // they are done LoadSound() only has to hand the samples to the audio device. Music streams
+    // decode as they play, so there is nothing to prefetch for them.
+    void PrefetchSounds(AssetLoader& Loader, const std::string& Directory);
+    void ClearPrefetchedSounds();
+    Sound LoadSound(const char* Path);
+    Music LoadMusicStream(const char* Path);
+}
+
+#endif // PLATFORM_HPP
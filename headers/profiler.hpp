@@ -0,0 +1,80 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <chrono>
+#include <string>
+
+// Per-zone frame timings for the dev tools. While nothing is listening a Scope only tests one
+// flag. With the overlay on, every Scope adds its duration to its zone's total for the frame
+// and EndFrame() files those totals into a ring buffer of the last History frames. During a
+// capture every Scope of a traced zone is also kept as an event, and the capture is written
+// out as Chrome trace-event JSON (open it in Perfetto or chrome://tracing) when it ends.
+namespace Profiler
+{
+    enum class Zone
+    {
+        FRAME,
+        FOREST_UPDATE, DUNGEON_UPDATE, MUSIC, CHARACTER_TICK,
+        ENEMIES, ENEMY_THINK, ENEMY_APPLY, CROWS, PROPS, PROP_TICK, TREES,
+        FOREST_DRAW, DUNGEON_DRAW, RENDER_QUEUE, DIALOGUE,
+        TEXTURE_LOAD, AUDIO_LOAD,
+        COUNT
+    };
+
+    constexpr int History{240};
+    constexpr float DefaultCaptureSeconds{5.f};
+
+    struct Stats
+    {
+        float Min{};
+        float Average{};
+        float P99{};
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    // Read by every Scope, so it lives in the header instead of behind a call
+    inline bool Enabled{false};
+
+    void SetEnabled(const bool Input);
+    void Record(const Zone Zone, const Clock::time_point Start, const Clock::time_point End);
+    void EndFrame();
+    int GetFrames();
+    Stats GetStats(const Zone Zone);
+    const char* GetName(const Zone Zone);
+    int GetDepth(const Zone Zone);
+
+    // Capture
+    void StartCapture(const float Seconds, const std::string& Path);
+    void StopCapture();
+    bool IsCapturing();
+
+    // Times the enclosing block: Profiler::Scope Timer{Profiler::Zone::FOREST_DRAW};
+    class Scope
+    {
+    public:
+        explicit Scope(const Zone Zone) : Timed{Zone}, Timing{Enabled}
+        {
+            if (Timing) {
+                Start = Clock::now();
+            }
+        }
+
+        ~Scope()
+        {
+            if (Timing) {
+                Record(Timed, Start, Clock::now());
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Zone Timed{};
+        bool Timing{false};             // Latched so toggling mid-frame never records half a scope
+        Clock::time_point Start{};
+    };
+}
+
+#endif // PROFILER_HPP
@@ -3,11 +3,19 @@
 
 #include <vector>
 #include <string>
-#include <tuple>
 #include <unordered_map>
+#include <array>
+#include <bitset>
 #include "sprite.hpp"
 #include "gameaudio.hpp"
 #include "background.hpp"
+#include "spatialgrid.hpp"
+#include "collisionmask.hpp"
+#include "profiler.hpp"
+#include "bakedlayer.hpp"
+#include "renderqueue.hpp"
+#include "items.hpp"
+#include "queststate.hpp"
 
 enum class PropType
 {
@@ -36,18 +44,13 @@ enum class PropType
     PLACEHOLDER
 };
 
-enum class Progress
-{
-    ACT_O, ACT_I, ACT_II, ACT_III, ACT_IV, ACT_V, ACT_VI, ACT_VII, ACT_VIII, ACT_IX, ACT_X
-};
-
 struct Props;
 
 class Prop 
 {
 public:
     // Constructor for inanimate props
-    Prop(const Texture2D& Texture, 
+    Prop(const AtlasTexture& Texture, 
          const Vector2 Pos, 
          const PropType Type, 
          const GameTexture& GameTextures, 
@@ -63,7 +66,7 @@ public:
          const PropType Type, 
          const GameTexture& GameTextures, 
          const GameAudio& Audio,
-         const std::string& ItemName = "None", 
+         const ItemId ItemType = ItemId::NONE, 
          const bool Spawned = false, 
          const bool Interactable = false);      
 
@@ -73,18 +76,19 @@ public:
          const PropType Type, 
          const GameTexture& GameTextures,
          const GameAudio& Audio, 
-         const Texture2D& Item, 
+         const AtlasTexture& Item, 
          const float Scale = 4.f, 
          const bool Moveable = false, 
          const bool Interactable = false, 
          const Progress TriggerAct = Progress::ACT_O, 
          const PropType TriggerNPC = PropType::NPC_O, 
          const bool Spawn = true,
-         const std::string& ItemName = "None", 
+         const ItemId ItemType = ItemId::NONE, 
          const float ItemScale = 2.f);
     
     void Tick(const float DeltaTime);
-    void Draw(const Vector2 CharacterWorldPos);
+    void Draw(RenderQueue& Queue, const RenderLayer Layer, const Vector2 CharacterWorldPos);
+    void DrawDialogue();
 
     void NpcTick(const float DeltaTime);
     void AltarTick(const float DeltaTime);
@@ -93,6 +97,7 @@ public:
     void CheckVisibility(const Vector2 CharacterWorldPos);
     void InsertAltarPiece();
     void TalkToNpc();
+    void UpdateQuest();
     void UpdateNpcInactive();
     void UpdateNpcActive();
     void CheckFinalChest();
@@ -110,31 +115,48 @@ public:
     constexpr bool IsActive() const {return Active;}
     constexpr bool IsOpened() const {return Opened;}
     constexpr bool IsSpawned() const {return Spawned;}
-    bool IsFinalAct() const {return FinalAct;}
+    static bool IsFinalAct() {return Quest.FinalAct;}
+    bool IsStaticCollider() const;
+    bool IsBakeable() const;
+    bool CanMove() const;
+    constexpr bool IsBaked() const {return Baked;}
     bool WithinScreen(const Vector2 CharacterWorldPos);
     
     constexpr Vector2 GetWorldPos() const {return WorldPos;}
     constexpr PropType GetType() const {return Type;}
-    std::string GetItemName() const {return ItemName;}
-    Rectangle GetCollisionRec(const Vector2 CharacterWorldPos);
-    Rectangle GetInteractRec(const Vector2 CharacterWorldPos);
+    constexpr ItemId GetItemType() const {return ItemType;}
+    constexpr Rectangle GetWorldCollisionRec() const {return CollisionRec;}
+    constexpr Rectangle GetWorldInteractRec() const {return InteractRec;}
+    Rectangle GetCollisionRec(const Vector2 CharacterWorldPos) const;
+    Rectangle GetInteractRec(const Vector2 CharacterWorldPos) const;
+    Rectangle GetWorldBounds() const;
+    Rectangle GetCullBounds() const;
+    Rectangle GetDrawRec() const;
     
     void SetActive(const bool Input) {Active = Input;}
     void SetOpened(const bool Input) {Opened = Input;}
     void SetSpawned(const bool Input) {Spawned = Input;}
-    void UndoMovement() {WorldPos = PrevWorldPos;}
-    bool CheckMovement(Background& Map, const Vector2 CharWorldPos, const Vector2 Direction, const float Speed, std::vector<std::vector<Prop>>& Props);
+    void SetBaked(const bool Input) {Baked = Input;}
+    void UndoMovement() {WorldPos = PrevWorldPos; UpdateShapes();}
+    bool CheckMovement(Background& Map, const Vector2 Direction, const float Speed, SpatialGrid<Prop>& Grid, const CollisionMask& Mask);
 
     void DrawPropText();
     void DrawSpeech();
+    void DrawSprite(const Vector2 Origin);
     
 private:
+    Rectangle CalculateCollisionRec() const;
+    Rectangle CalculateInteractRec() const;
+    void UpdateShapes();
+
     Sprite Object{};
     const PropType Type{};
     const GameTexture& GameTextures;
     const GameAudio& Audio;
     Vector2 WorldPos{};
     Vector2 PrevWorldPos{};
+    Rectangle CollisionRec{};           // World-space shapes, refreshed whenever WorldPos changes
+    Rectangle InteractRec{};
     float Scale {4.f};
     bool Opened{false};
     bool Opening{false};
@@ -149,6 +171,7 @@ private:
     bool Spawned{true};
     bool Reading{false};
     bool PageOpen{false};
+    bool Baked{false};                  // Drawn by a BakedLayer chunk instead of Draw()
 
     // NPC variables
     Progress Act{Progress::ACT_I};
@@ -158,51 +181,112 @@ private:
     bool MuteNewInfo{false};
     bool ReadyToProgress{false};
 
-    static inline std::unordered_map<PropType, std::pair<Progress, PropType>> QuestlineProgress
-    {
-        {PropType::NPC_DIANA, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::NPC_JADE, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::NPC_SON, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::NPC_RUMBY, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::NPC_O, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::TREASURE, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-    };
 
     // Treasure variables
     bool ReceiveItem{false};
     bool InsertPiece{false};
-    const Texture2D Item{};
-    const std::string ItemName{};
+    const AtlasTexture Item{};
+    const ItemId ItemType{ItemId::NONE};
     float ItemScale{};
     Vector2 ItemPos{};
     float RunningTime{};
-    static inline int PiecesReceived{0};
-    static inline int PiecesAdded{0};
-    static inline bool SonSaved{false};
-    static inline bool FinalAct{false};
-    static inline bool BraceletReceived{false};
-    static inline bool CryptexReceived{false};
-    static inline bool FinalChestKey{false};
-    static inline bool FinalChestSpawned{false};
-    static inline bool FirstPieceInserted{false};
-
-    static inline std::vector<std::tuple<std::string, bool, bool, bool>> AltarPieces {
-            // {"ItemName", ItemUnlocked, ItemVisible, ItemInserted}
-            {"Top Left Altar Piece", false, false, false}, 
-            {"Top Altar Piece", false, false, false}, 
-            {"Top Right Altar Piece", false, false, false}, 
-            {"Bottom Left Altar Piece", false, false, false},
-            {"Bottom Altar Piece", false, false, false}, 
-            {"Bottom Right Altar Piece", false, false, false}
+    static inline QuestState Quest{};
+
+    // What UpdateQuest() last ran against. It only runs again once a subscribed quest variable or
+    // one of these has changed, or when its last run changed something and may not have settled.
+    struct QuestInputs
+    {
+        Progress Act{};
+        Vector2 WorldPos{};
+        bool Visible{};
+        bool Spawned{};
+        bool NewInfo{};
+        bool MuteNewInfo{};
+        bool ReadyToProgress{};
+
+        bool operator==(const QuestInputs& Other) const;
     };
+    static std::uint16_t GetQuestSubscriptions(const PropType Type);
+    QuestInputs GetQuestInputs() const;
+
+    const std::uint16_t QuestSubscriptions{GetQuestSubscriptions(Type)};
+    QuestState SeenQuest{};
+    QuestState SeenTriggers{};          // Quest as NpcTick() last checked it for act triggers
+    QuestInputs SeenInputs{};
+    bool QuestSettled{false};
+
+    // Scratch buffer for boulder neighbour lookups, reused so pushing never allocates
+    static inline std::vector<Prop*> Neighbours{};
+
+    // Altar pieces by ItemId: found in a chest, showing on the altar, counted towards the final chest
+    static inline std::bitset<AltarPieceCount> PiecesUnlocked{};
+    static inline std::bitset<AltarPieceCount> PiecesVisible{};
+    static inline std::bitset<AltarPieceCount> PiecesInserted{};
+};
+
+// Props of one draw layer bucketed by the area in which they count as on screen,
+// so drawing only walks the props around the camera instead of the whole layer
+class VisibleSet
+{
+public:
+    void Insert(Prop& Item);
+    void Move(Prop& Item);
+    void Clear(const Vector2 WorldSize);
+    const std::vector<Prop*>& Update(const Vector2 CharacterWorldPos);
+
+    SpatialGrid<Prop>::Baked Export() const;
+    bool Import(SpatialGrid<Prop>::Baked&& Source);
+
+private:
+    SpatialGrid<Prop> Grid{};
+    std::vector<Prop*> Shown{};
 };
 
 struct Props
 {
     Props(const std::vector<std::vector<Prop>>& Under, const std::vector<std::vector<Prop>>& Over);
 
+    void BuildGrids(std::vector<Prop>& Trees, const Vector2 WorldSize);
+    void UpdateGrids();
+
+    // For indexes baked into the level file: empty grids to import into, then the movers to follow
+    void ResetGrids(const Vector2 WorldSize);
+    void TrackMovers();
+
+    // Treasure chests of the over layer by the item they hold, so a reward spawns without a search
+    void IndexRewards();
+    void SpawnReward(const ItemId Reward);
+
     std::vector<std::vector<Prop>> Under{};
     std::vector<std::vector<Prop>> Over{};
+
+    // Collidable props bucketed by world position, built once the containers stop moving
+    SpatialGrid<Prop> UnderGrid{};
+    SpatialGrid<Prop> OverGrid{};
+
+    // Colliders that never move, despawn or react to touch, baked once at load
+    CollisionMask StaticMask{};
+    SpatialGrid<Prop> StaticGrid{};         // The same colliders and the trees, for enemies steering around them
+
+    // Every prop of a layer, used to cull drawing to what is around the camera
+    VisibleSet UnderVisible{};
+    VisibleSet OverVisible{};
+    VisibleSet TreeVisible{};
+
+    // Static decoration of the under layer composited into chunks, only built when there is a window
+    BakedLayer UnderBake{};
+
+private:
+    // Props that can change position after load (boulders, relocating NPCs) and the indexes holding them
+    struct Mover
+    {
+        SpatialGrid<Prop>* Grid{nullptr};
+        VisibleSet* Visible{nullptr};
+        Prop* Item{nullptr};
+    };
+    std::vector<Mover> Movers{};
+
+    std::array<std::vector<Prop*>, ItemCount> Rewards{};
 };
 
 #endif // PROP_HPP
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef QUESTSTATE_HPP
+#define QUESTSTATE_HPP
+
+#include <array>
+#include <cstdint>
+
+enum class PropType;
+
+enum class Progress
+{
+    ACT_O, ACT_I, ACT_II, ACT_III, ACT_IV, ACT_V, ACT_VI, ACT_VII, ACT_VIII, ACT_IX, ACT_X
+};
+
+// One bit per quest variable, so a prop can subscribe to just the ones its quest logic reads
+enum QuestVar : std::uint16_t
+{
+    PIECES_RECEIVED = 1, PIECES_ADDED = 2, SON_SAVED = 4, FINAL_ACT = 8, BRACELET_RECEIVED = 16,
+    CRYPTEX_RECEIVED = 32, FINAL_CHEST_KEY = 64, FINAL_CHEST_SPAWNED = 128, FIRST_PIECE_INSERTED = 256,
+    ACT_TRIGGERS = 512
+};
+
+// Who hands out act triggers, one slot each
+enum TriggerSource : std::uint8_t
+{
+    DIANA_TRIGGER, JADE_TRIGGER, SON_TRIGGER, RUMBY_TRIGGER, TREASURE_TRIGGER, TriggerSourceCount
+};
+
+// An act waiting for an NPC to pick it up the next time it ticks
+struct ActTrigger
+{
+    Progress Act{Progress::ACT_O};
+    PropType Npc{};
+
+    constexpr bool operator==(const ActTrigger&) const = default;
+};
+
+// Quest progress shared by every NPC and chest
+struct QuestState
+{
+    int PiecesReceived{0};
+    int PiecesAdded{0};
+    bool SonSaved{false};
+    bool FinalAct{false};
+    bool BraceletReceived{false};
+    bool CryptexReceived{false};
+    bool FinalChestKey{false};
+    bool FinalChestSpawned{false};
+    bool FirstPieceInserted{false};
+    std::array<ActTrigger, TriggerSourceCount> Triggers{};
+
+    // QuestVar bits of the variables that differ from Seen
+    constexpr std::uint16_t Changed(const QuestState& Seen) const
+    {
+        return (PiecesReceived != Seen.PiecesReceived ? PIECES_RECEIVED : 0) |
+               (PiecesAdded != Seen.PiecesAdded ? PIECES_ADDED : 0) |
+               (SonSaved != Seen.SonSaved ? SON_SAVED : 0) |
+               (FinalAct != Seen.FinalAct ? FINAL_ACT : 0) |
+               (BraceletReceived != Seen.BraceletReceived ? BRACELET_RECEIVED : 0) |
+               (CryptexReceived != Seen.CryptexReceived ? CRYPTEX_RECEIVED : 0) |
+               (FinalChestKey != Seen.FinalChestKey ? FINAL_CHEST_KEY : 0) |
+               (FinalChestSpawned != Seen.FinalChestSpawned ? FINAL_CHEST_SPAWNED : 0) |
+               (FirstPieceInserted != Seen.FirstPieceInserted ? FIRST_PIECE_INSERTED : 0) |
+               (Triggers != Seen.Triggers ? ACT_TRIGGERS : 0);
+    }
+};
+
+#endif // QUESTSTATE_HPP
@@ -0,0 +1,56 @@
+#ifndef RENDERQUEUE_HPP
+#define RENDERQUEUE_HPP
+
+#include <raylib.h>
+#include <cstdint>
+#include <vector>
+#include "textureatlas.hpp"
+
+// Draw layers, back to front. WORLD is ordered by where things meet the ground so the fox can
+// walk both behind and in front of a tree. The other layers overlap by design (the over layer
+// is placed to cover the fox) and keep the order their sprites were submitted in.
+enum class RenderLayer : std::uint8_t
+{
+    UNDER, WORLD, SKY, OVER, OVERLAY
+};
+
+// Sprites of one frame, submitted in any order and drawn by Flush() sorted by a 64-bit key:
+// layer, then depth (the bottom edge of the sprite, or the submission order for unsorted
+// layers), then texture. Sprites on the same depth share a texture run, so raylib can batch them.
+class RenderQueue
+{
+public:
+    void Submit(const RenderLayer Layer, const AtlasTexture& Texture, Rectangle Source, const Rectangle Dest, const Color Tint);
+    void Submit(const RenderLayer Layer, const Texture2D& Texture, const Rectangle Source, const Rectangle Dest, const Color Tint);
+    void Submit(const RenderLayer Layer, const AtlasTexture& Texture, const Vector2 Position, const float Scale, const Color Tint);
+    void Flush();
+
+    int GetCount() const {return static_cast<int>(Commands.size());}
+
+private:
+    struct Command
+    {
+        Texture2D Texture{};
+        Rectangle Source{};
+        Rectangle Dest{};
+        Color Tint{};
+    };
+
+    struct Entry
+    {
+        std::uint64_t Key{};
+        std::uint32_t Index{};
+    };
+
+    static std::uint64_t MakeKey(const RenderLayer Layer, const std::uint32_t Depth, const unsigned int TextureId);
+    static std::uint32_t SortableDepth(const float Depth);
+    void Sort();
+
+    std::vector<Command> Commands{};
+
+    // Reused between frames so a frame never allocates once warmed up
+    std::vector<Entry> Entries{};
+    std::vector<Entry> Scratch{};
+};
+
+#endif // RENDERQUEUE_HPP
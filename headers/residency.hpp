@@ -0,0 +1,32 @@
+#ifndef RESIDENCY_HPP
+#define RESIDENCY_HPP
+
+#include "background.hpp"
+
+// Keeps only the current area's art and theme loaded. Request() starts decoding the next area on
+// the loader's workers as soon as the player heads there, and Finish() uploads it and releases
+// the area being left once the transition has faded out, so the old area can still be drawn
+// during the fade.
+class Residency
+{
+public:
+    Residency(GameTexture& Textures, GameAudio& Audio, AssetLoader& Loader, const Area Start);
+    Residency(const Residency&) = delete;
+    Residency& operator=(const Residency&) = delete;
+
+    void Request(const Area NextMap);
+    void Finish();
+
+private:
+    static int GetGroup(const Area Map);
+    Music& GetTheme(const Area Map);
+    void OpenTheme(const Area Map);
+
+    GameTexture& Textures;
+    GameAudio& Audio;
+    AssetLoader& Loader;
+    Area Current{};
+    Area Next{};
+};
+
+#endif // RESIDENCY_HPP
@@ -0,0 +1,258 @@
+#ifndef SPATIALGRID_HPP
+#define SPATIALGRID_HPP
+
+#include <raylib.h>
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+// Uniform grid over world space. Objects are registered with their world-space bounds and
+// a query only visits the cells the query rectangle overlaps, so the cost of a lookup
+// depends on how crowded the area is rather than on how many objects the map holds.
+template <typename Object>
+class SpatialGrid
+{
+public:
+    SpatialGrid() = default;
+    SpatialGrid(const Vector2 WorldSize, const float CellSize = 128.f);
+
+    void Insert(Object& Item, const Rectangle Bounds);
+    void Move(Object& Item, const Rectangle Bounds);
+    void Clear();
+    const std::vector<Object*>& Query(const Rectangle Area);
+    void Query(const Rectangle Area, std::vector<Object*>& Out);
+    void Query(const Rectangle Area, std::vector<int>& Scratch, std::vector<Object*>& Out) const;
+
+    constexpr int GetCount() const {return static_cast<int>(Entries.size());}
+    constexpr float GetCellSize() const {return CellSize;}
+    constexpr int GetColumns() const {return Columns;}
+    constexpr int GetRows() const {return Rows;}
+
+    // Raw contents in registration order, so an index built offline (see levelc) can be
+    // written out and later adopted as-is instead of inserting every object again
+    struct Baked
+    {
+        float CellSize{};
+        int Columns{};
+        int Rows{};
+        std::vector<Object*> Items{};
+        std::vector<Rectangle> Bounds{};
+        std::vector<std::vector<int>> Cells{};
+    };
+    Baked Export() const;
+    bool Import(Baked&& Source);
+
+private:
+    struct Entry
+    {
+        Object* Item{nullptr};
+        Rectangle Bounds{};
+        int Stamp{};
+    };
+
+    int CellX(const float X) const;
+    int CellY(const float Y) const;
+    void Link(const int Index);
+    void Unlink(const int Index);
+
+    float CellSize{128.f};
+    int Columns{1};
+    int Rows{1};
+    int Stamp{};
+    std::vector<Entry> Entries{};
+    std::vector<std::vector<int>> Cells{std::vector<std::vector<int>>(1)};
+    std::unordered_map<const Object*, int> Lookup{};
+
+    // Reused between queries so a lookup never allocates once warmed up
+    std::vector<int> Found{};
+    std::vector<Object*> Results{};
+};
+
+template <typename Object>
+SpatialGrid<Object>::SpatialGrid(const Vector2 WorldSize, const float CellSize)
+    : CellSize{CellSize},
+      Columns{std::max(1, static_cast<int>(std::ceil(WorldSize.x / CellSize)))},
+      Rows{std::max(1, static_cast<int>(std::ceil(WorldSize.y / CellSize)))},
+      Cells(Columns * Rows)
+{
+
+}
+
+template <typename Object>
+void SpatialGrid<Object>::Insert(Object& Item, const Rectangle Bounds)
+{
+    Lookup[&Item] = static_cast<int>(Entries.size());
+    Entries.push_back(Entry{&Item, Bounds, Stamp});
+    Link(static_cast<int>(Entries.size()) - 1);
+}
+
+template <typename Object>
+void SpatialGrid<Object>::Move(Object& Item, const Rectangle Bounds)
+{
+    auto Existing{Lookup.find(&Item)};
+    if (Existing == Lookup.end()) {
+        Insert(Item, Bounds);
+        return;
+    }
+
+    Entry& Current{Entries.at(Existing->second)};
+
+    // Only relink when the object actually crossed into different cells
+    if (CellX(Bounds.x) != CellX(Current.Bounds.x) || CellX(Bounds.x + Bounds.width) != CellX(Current.Bounds.x + Current.Bounds.width) ||
+        CellY(Bounds.y) != CellY(Current.Bounds.y) || CellY(Bounds.y + Bounds.height) != CellY(Current.Bounds.y + Current.Bounds.height))
+    {
+        Unlink(Existing->second);
+        Current.Bounds = Bounds;
+        Link(Existing->second);
+    }
+    else {
+        Current.Bounds = Bounds;
+    }
+}
+
+template <typename Object>
+void SpatialGrid<Object>::Clear()
+{
+    for (auto& Cell:Cells) {
+        Cell.clear();
+    }
+    Entries.clear();
+    Lookup.clear();
+}
+
+template <typename Object>
+typename SpatialGrid<Object>::Baked SpatialGrid<Object>::Export() const
+{
+    Baked Out{CellSize, Columns, Rows};
+    Out.Cells = Cells;
+    for (auto& Existing:Entries) {
+        Out.Items.push_back(Existing.Item);
+        Out.Bounds.push_back(Existing.Bounds);
+    }
+    return Out;
+}
+
+// Takes over a baked index for a grid of the same dimensions, refusing anything that doesn't line up
+template <typename Object>
+bool SpatialGrid<Object>::Import(Baked&& Source)
+{
+    const int Count{static_cast<int>(Source.Items.size())};
+    if (Source.CellSize != CellSize || Source.Columns != Columns || Source.Rows != Rows ||
+        Source.Bounds.size() != Source.Items.size() || Source.Cells.size() != Cells.size())
+    {
+        return false;
+    }
+    for (auto& Cell:Source.Cells) {
+        if (std::any_of(Cell.begin(), Cell.end(), [Count](const int Index) {return Index < 0 || Index >= Count;})) {
+            return false;
+        }
+    }
+
+    Clear();
+    Entries.reserve(Count);
+    Lookup.reserve(Count);
+    for (int Index = 0; Index < Count; ++Index) {
+        Lookup[Source.Items[Index]] = Index;
+        Entries.push_back(Entry{Source.Items[Index], Source.Bounds[Index], Stamp});
+    }
+    Cells = std::move(Source.Cells);
+    return true;
+}
+
+template <typename Object>
+const std::vector<Object*>& SpatialGrid<Object>::Query(const Rectangle Area)
+{
+    Query(Area, Results);
+    return Results;
+}
+
+// Fills a caller-owned buffer, for lookups made while iterating the results of another query
+template <typename Object>
+void SpatialGrid<Object>::Query(const Rectangle Area, std::vector<Object*>& Out)
+{
+    ++Stamp;
+    Found.clear();
+
+    for (int Y = CellY(Area.y); Y <= CellY(Area.y + Area.height); ++Y) {
+        for (int X = CellX(Area.x); X <= CellX(Area.x + Area.width); ++X) {
+            for (auto Index:Cells[Y * Columns + X]) {
+                // Objects spanning several cells are only reported once per query
+                if (Entries[Index].Stamp != Stamp) {
+                    Entries[Index].Stamp = Stamp;
+                    Found.push_back(Index);
+                }
+            }
+        }
+    }
+
+    // Hand results back in registration order so callers behave exactly like a linear scan
+    std::sort(Found.begin(), Found.end());
+
+    Out.clear();
+    for (auto Index:Found) {
+        Out.push_back(Entries[Index].Item);
+    }
+}
+
+// Leaves the grid untouched, so any number of threads can query it at once. Duplicates are
+// dropped by sorting instead of stamping entries.
+template <typename Object>
+void SpatialGrid<Object>::Query(const Rectangle Area, std::vector<int>& Scratch, std::vector<Object*>& Out) const
+{
+    Scratch.clear();
+
+    for (int Y = CellY(Area.y); Y <= CellY(Area.y + Area.height); ++Y) {
+        for (int X = CellX(Area.x); X <= CellX(Area.x + Area.width); ++X) {
+            const auto& Cell{Cells[Y * Columns + X]};
+            Scratch.insert(Scratch.end(), Cell.begin(), Cell.end());
+        }
+    }
+
+    std::sort(Scratch.begin(), Scratch.end());
+    Scratch.erase(std::unique(Scratch.begin(), Scratch.end()), Scratch.end());
+
+    Out.clear();
+    for (auto Index:Scratch) {
+        Out.push_back(Entries[Index].Item);
+    }
+}
+
+template <typename Object>
+int SpatialGrid<Object>::CellX(const float X) const
+{
+    return std::clamp(static_cast<int>(std::floor(X / CellSize)), 0, Columns - 1);
+}
+
+template <typename Object>
+int SpatialGrid<Object>::CellY(const float Y) const
+{
+    return std::clamp(static_cast<int>(std::floor(Y / CellSize)), 0, Rows - 1);
+}
+
+template <typename Object>
+void SpatialGrid<Object>::Link(const int Index)
+{
+    const Rectangle& Bounds{Entries[Index].Bounds};
+
+    for (int Y = CellY(Bounds.y); Y <= CellY(Bounds.y + Bounds.height); ++Y) {
+        for (int X = CellX(Bounds.x); X <= CellX(Bounds.x + Bounds.width); ++X) {
+            Cells[Y * Columns + X].push_back(Index);
+        }
+    }
+}
+
+template <typename Object>
+void SpatialGrid<Object>::Unlink(const int Index)
+{
+    const Rectangle& Bounds{Entries[Index].Bounds};
+
+    for (int Y = CellY(Bounds.y); Y <= CellY(Bounds.y + Bounds.height); ++Y) {
+        for (int X = CellX(Bounds.x); X <= CellX(Bounds.x + Bounds.width); ++X) {
+            auto& Cell{Cells[Y * Columns + X]};
+            Cell.erase(std::remove(Cell.begin(), Cell.end(), Index), Cell.end());
+        }
+    }
+}
+
+#endif // SPATIALGRID_HPP
@@ -1,17 +1,17 @@
 #ifndef SPRITE_HPP
 #define SPRITE_HPP
 
-#include <raylib.h>
+#include "textureatlas.hpp"
 
 struct Sprite
 {
     Sprite() = default;
-    explicit Sprite(const Texture2D& Texture, const int MaxFramesX = 1, const int MaxFramesY = 1, const float UpdateSpeed = 1.f/8.f);
+    explicit Sprite(const AtlasTexture& Texture, const int MaxFramesX = 1, const int MaxFramesY = 1, const float UpdateSpeed = 1.f/8.f);
     void Tick(float DeltaTime);
     Rectangle GetSourceRec();
     Rectangle GetPosRec(const Vector2& ScreenPos, const float Scale);
 
-    const Texture2D Texture{};
+    const AtlasTexture Texture{};
     int MaxFramesX{};
     int MaxFramesY{};
     int FrameX{};
@@ -0,0 +1,109 @@
+#ifndef TEXTUREATLAS_HPP
+#define TEXTUREATLAS_HPP
+
+#include <raylib.h>
+#include "assetloader.hpp"
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Where one image ended up: the GPU texture holding it and its rectangle inside that texture
+struct AtlasEntry
+{
+    Texture2D Texture{};
+    Rectangle Region{};
+};
+
+// Handle to an image in a TextureAtlas. width and height are the image's own size, named like
+// Texture2D's so sizing code reads the same; the DrawTexture overloads below map source
+// rectangles from image space into the atlas page. An empty handle draws nothing.
+struct AtlasTexture
+{
+    const AtlasEntry* Entry{nullptr};
+    int width{};
+    int height{};
+};
+
+// A large image cut into tiles that are packed like any other image, so it can be bigger than
+// the GPU's largest texture and drawing it can skip the tiles that are off screen
+struct TiledTexture
+{
+    std::vector<AtlasTexture> Tiles{};  // Row by row
+    int Columns{};
+    int Rows{};
+    int TileSize{};
+    int width{};
+    int height{};
+};
+
+// Packs small images into a few large pages so consecutive draws share a texture and raylib can
+// batch them. Add() only reads an image's size from its PNG header, Decode() hands the pixels to
+// the loader's workers and Upload() packs and uploads on the main thread once they are done.
+// Upload() decodes whatever Decode() was not asked for itself, and headless runs skip the pixels
+// entirely. Images too big to share a page are uploaded on their own.
+//
+// Every image belongs to a group and pages never mix groups, so a group can be released and
+// uploaded again later without touching the others. Handles stay valid while their group is
+// released; they just draw nothing.
+class TextureAtlas
+{
+public:
+    TextureAtlas() = default;
+    ~TextureAtlas();
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    AtlasTexture Add(const char* Path, const int Group = 0);
+    TiledTexture AddTiled(const char* Path, const int Group = 0, const int TileSize = 256);
+    void Decode(AssetLoader& Loader, const int Group);  // No Add() after this, the workers hold on to the images
+    void Upload(const int Group);
+    void Release(const int Group);
+    void Build();                       // Uploads every group, for runs that never change area
+    AtlasTexture Find(const std::string& Path) const;   // Empty handle when Path was never added
+
+    bool IsResident(const int Group) const {return Resident.at(Group);}
+    int GetPageCount() const {return static_cast<int>(Pages.size());}
+
+private:
+    struct Item
+    {
+        std::string Path{};
+        Image Source{};                 // Only the size unless decoded and not yet uploaded
+        AtlasEntry* Entry{nullptr};     // Null for a tiled image, its tiles are what gets packed
+        int Group{};
+        int Page{-1};                   // -1 until packed, stays -1 for images that failed to load
+        int Parent{-1};                 // For a tile, the tiled image its pixels are cut from
+        int OffsetX{};
+        int OffsetY{};
+    };
+
+    struct Page
+    {
+        int Group{};
+        int Standalone{-1};             // Item uploaded on its own, -1 for a shared page
+        Texture2D Texture{};            // Size only while the group is released
+    };
+
+    void Pack();
+    void UpdateEntries(const int Group);
+    static Image ReadSize(const char* Path);
+
+    static constexpr int PageSize{2048};
+    static constexpr int MaxPackedSize{512};
+    static constexpr int Padding{2};    // Keeps neighbouring images out of each other's edge texels
+
+    std::deque<AtlasEntry> Entries{};   // Deque so handles keep pointing at their entry as more are added
+    std::vector<Item> Items{};
+    std::unordered_map<std::string, int> Lookup{};      // Path to index in Items
+    std::vector<Page> Pages{};
+    std::vector<bool> Resident{};       // Per group
+    bool Packed{false};
+};
+
+void DrawTextureEx(const AtlasTexture& Texture, Vector2 Position, float Rotation, float Scale, Color Tint);
+void DrawTexturePro(const AtlasTexture& Texture, Rectangle Source, Rectangle Dest, Vector2 Origin, float Rotation, Color Tint);
+void DrawTiles(const TiledTexture& Texture, Vector2 Position, float Scale, Rectangle View, Color Tint);
+Rectangle GetPageSource(const AtlasTexture& Texture, Rectangle Source);
+
+#endif // TEXTUREATLAS_HPP
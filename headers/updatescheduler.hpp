@@ -0,0 +1,43 @@
+#ifndef UPDATESCHEDULER_HPP
+#define UPDATESCHEDULER_HPP
+
+#include <raylib.h>
+
+enum class Activity
+{
+    NEAR, MID, FAR
+};
+
+// How far past the screen edges each tier reaches, and how often the mid tier updates
+struct ActivityBudget
+{
+    float NearMargin{128.f};
+    float MidMargin{384.f};
+    int MidInterval{4};
+};
+
+// Decides how often an entity updates from how far it is from what the player can see. Near ones
+// update every step. Mid-range ones update every MidInterval steps and cover the skipped steps in
+// one coarse move, staggered by slot so they don't all land on the same step. Far ones only react
+// to events such as a boss being summoned.
+class UpdateScheduler
+{
+public:
+    UpdateScheduler() = default;
+    explicit UpdateScheduler(const ActivityBudget& Budget);
+
+    void BeginStep(const Vector2 CharacterWorldPos);
+    Activity Classify(const Vector2 WorldPos) const;
+    int GetSteps(const Vector2 WorldPos, const int Slot) const;    // 0 when the entity sits this step out
+
+    const ActivityBudget& GetBudget() const {return Budget;}
+    void SetBudget(const ActivityBudget& Input) {Budget = Input;}
+
+private:
+    ActivityBudget Budget{};
+    Rectangle Near{};
+    Rectangle Mid{};
+    int Step{};
+};
+
+#endif // UPDATESCHEDULER_HPP
@@ -0,0 +1,74 @@
+#include "assetloader.hpp"
+#include <algorithm>
+
+AssetLoader::AssetLoader(const int Threads)
+{
+    for (int Thread = 0; Thread < std::max(1, Threads); ++Thread) {
+        Workers.emplace_back([this] {Work();});
+    }
+}
+
+AssetLoader::~AssetLoader()
+{
+    {
+        std::lock_guard<std::mutex> Guard{Lock};
+        Stopping = true;
+    }
+    Wake.notify_all();
+
+    // Workers drain the queue before they exit, so nothing submitted is lost
+    for (auto& Worker:Workers) {
+        Worker.join();
+    }
+}
+
+void AssetLoader::Submit(std::function<void()> Job)
+{
+    {
+        std::lock_guard<std::mutex> Guard{Lock};
+        Jobs.push_back(std::move(Job));
+        ++Submitted;
+    }
+    Wake.notify_one();
+}
+
+void AssetLoader::Wait()
+{
+    std::unique_lock<std::mutex> Guard{Lock};
+    Idle.wait(Guard, [this] {return IsDone();});
+}
+
+float AssetLoader::GetProgress() const
+{
+    int Total{Submitted.load()};
+    return Total > 0 ? static_cast<float>(Finished.load()) / static_cast<float>(Total) : 1.f;
+}
+
+int AssetLoader::GetDefaultThreads()
+{
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+}
+
+void AssetLoader::Work()
+{
+    while (true) {
+        std::function<void()> Job{};
+        {
+            std::unique_lock<std::mutex> Guard{Lock};
+            Wake.wait(Guard, [this] {return Stopping || !Jobs.empty();});
+            if (Jobs.empty()) {
+                return;
+            }
+            Job = std::move(Jobs.front());
+            Jobs.pop_front();
+        }
+
+        Job();
+
+        {
+            std::lock_guard<std::mutex> Guard{Lock};
+            ++Finished;
+        }
+        Idle.notify_all();
+    }
+}
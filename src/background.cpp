@@ -1,4 +1,5 @@
 #include "background.hpp"
+#include "residency.hpp"
 
 Background::Background(const GameTexture& GameTextures, const GameAudio& Audio)
     : GameTextures{GameTextures}, Audio{Audio}
@@ -10,28 +11,44 @@ void Background::Tick(const Vector2 WorldPos)
 {
     MapPos = Vector2Scale(WorldPos, -1.f);
 
-    if (IsKeyPressed(KEY_M)) {
+    if (Platform::IsKeyPressed(KEY_M)) {
         MiniMapOpen = !MiniMapOpen;
         SetSoundVolume(Audio.Transition, 0.2f);
         PlaySound(Audio.Transition);
     }
 }
 
+// Starts loading the next area's assets; they replace the current area's in FinishAreaChange()
+void Background::SetArea(const Area& NextMap)
+{
+    Map = NextMap;
+    if (Areas) {
+        Areas->Request(NextMap);
+    }
+}
+
+void Background::FinishAreaChange()
+{
+    if (Areas) {
+        Areas->Finish();
+    }
+}
+
 void Background::DrawForest() 
 {
-    DrawTextureEx(GameTextures.Map, MapPos, 0.0f, Scale, WHITE);
+    DrawTiles(GameTextures.Map, MapPos, Scale, GetView(), WHITE);
 }
 
 void Background::DrawDungeon()
 {
-    DrawTextureEx(GameTextures.DungeonMap, MapPos, 0.0f, Scale, WHITE);
+    DrawTiles(GameTextures.DungeonMap, MapPos, Scale, GetView(), WHITE);
 }
 
 void Background::DrawMiniMap(const Vector2 CharWorldPos)
 {
     Vector2 Position {
-        static_cast<float>(GetScreenWidth()/1.3f - (GameTextures.MiniMap.width/2) * .35f),
-        static_cast<float>(GetScreenHeight()/2.f - (GameTextures.MiniMap.height/2) * .35f)
+        static_cast<float>(Platform::GetScreenWidth()/1.3f - (GameTextures.MiniMap.width/2) * .35f),
+        static_cast<float>(Platform::GetScreenHeight()/2.f - (GameTextures.MiniMap.height/2) * .35f)
     };
 
     if (MiniMapOpen) {
@@ -42,6 +59,12 @@ void Background::DrawMiniMap(const Vector2 CharWorldPos)
     }
 }
 
+// The screen, padded so the interpolated camera's trailing offset never uncovers an undrawn tile
+Rectangle Background::GetView() const
+{
+    return Rectangle{-CullMargin, -CullMargin, Platform::GetScreenWidth() + CullMargin * 2.f, Platform::GetScreenHeight() + CullMargin * 2.f};
+}
+
 Vector2 Background::GetForestMapSize()
 {
     return Vector2{static_cast<float>(GameTextures.Map.width) * Scale, static_cast<float>(GameTextures.Map.height) * Scale};
@@ -0,0 +1,245 @@
+#include "bakedlayer.hpp"
+#include "prop.hpp"
+#include "platform.hpp"
+#include <algorithm>
+#include <cmath>
+
+BakedLayer::~BakedLayer()
+{
+    Clear();
+}
+
+void BakedLayer::Build(std::vector<std::vector<Prop>>& Layer, const Vector2 WorldSize)
+{
+    Clear();
+
+    Columns = std::max(1, static_cast<int>(std::ceil(WorldSize.x / ChunkSize)));
+    Rows = std::max(1, static_cast<int>(std::ceil(WorldSize.y / ChunkSize)));
+    Beneath.resize(Columns * Rows);
+    Above.resize(Columns * Rows);
+
+    std::vector<Prop*> Order{};
+    for (auto& Proptype:Layer) {
+        for (auto& Prop:Proptype) {
+            Order.push_back(&Prop);
+        }
+    }
+
+    auto Fits = [WorldSize](const Prop& Item) {
+        Rectangle Rec{Item.GetDrawRec()};
+        return Item.IsBakeable() && Rec.x >= 0.f && Rec.y >= 0.f && Rec.x + Rec.width <= WorldSize.x && Rec.y + Rec.height <= WorldSize.y;
+    };
+
+    // The grids only narrow things down to nearby props, the draw rectangles decide
+    auto Covered = [](SpatialGrid<Prop>& Grid, const Rectangle Rec) {
+        for (auto Other:Grid.Query(Rec)) {
+            if (CheckCollisionRecs(Rec, Other->GetDrawRec())) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Movers at the very end of the layer are drawn over everything else anyway
+    std::size_t TrailStart{Order.size()};
+    while (TrailStart > 0 && Order[TrailStart - 1]->CanMove()) {
+        --TrailStart;
+    }
+    Trailing.assign(Order.begin() + TrailStart, Order.end());
+
+    // Beneath: nothing left live before the prop overlaps it. Once a mover has been passed nothing
+    // qualifies any more, it could be pushed on top of any of the props that follow.
+    SpatialGrid<Prop> Live{WorldSize};
+    bool MoverSeen{false};
+
+    for (auto Item:Order) {
+        Rectangle Rec{Item->GetDrawRec()};
+
+        if (!MoverSeen && Fits(*Item) && !Covered(Live, Rec)) {
+            Item->SetBaked(true);
+            Add(Beneath, *Item);
+
+            if (Item->CanMove()) {
+                Movers.push_back(Resting{Item, Rec});
+            }
+        }
+        else {
+            Live.Insert(*Item, Rec);
+        }
+
+        MoverSeen = MoverSeen || Item->CanMove();
+    }
+
+    // Above: the same walking backwards, nothing left live after the prop overlaps it. Props baked
+    // beneath can be skipped, none of them overlaps a live prop drawn before it.
+    SpatialGrid<Prop> Later{WorldSize};
+    bool MoverLater{false};
+    std::vector<Prop*> Lifted{};
+
+    for (std::size_t Index{TrailStart}; Index-- > 0;) {
+        Prop* Item{Order[Index]};
+        if (Item->IsBaked()) {
+            continue;
+        }
+
+        Rectangle Rec{Item->GetDrawRec()};
+
+        if (!MoverLater && !Item->CanMove() && Fits(*Item) && !Covered(Later, Rec)) {
+            Item->SetBaked(true);
+            Lifted.push_back(Item);
+        }
+        else {
+            Later.Insert(*Item, Rec);
+        }
+
+        MoverLater = MoverLater || Item->CanMove();
+    }
+
+    for (auto Item{Lifted.rbegin()}; Item != Lifted.rend(); ++Item) {
+        Add(Above, **Item);
+    }
+}
+
+void BakedLayer::Clear()
+{
+    for (auto Chunks:{&Beneath, &Above}) {
+        for (auto& Slot:*Chunks) {
+            for (auto Item:Slot.Items) {
+                Item->SetBaked(false);
+            }
+            if (Slot.Target.id > 0) {
+                UnloadRenderTexture(Slot.Target);
+            }
+        }
+        Chunks->clear();
+    }
+
+    Movers.clear();
+    Trailing.clear();
+    Columns = 0;
+    Rows = 0;
+}
+
+void BakedLayer::Refresh(const Vector2 CharacterWorldPos)
+{
+    // A boulder that left its spot is drawn live from now on and the chunks it was baked into lose it
+    for (auto Mover{Movers.begin()}; Mover != Movers.end();) {
+        Rectangle Rec{Mover->Item->GetDrawRec()};
+        if (Rec.x == Mover->DrawRec.x && Rec.y == Mover->DrawRec.y) {
+            ++Mover;
+            continue;
+        }
+
+        Mover->Item->SetBaked(false);
+        for (int Index{}; Index < static_cast<int>(Beneath.size()); ++Index) {
+            if (CheckCollisionRecs(Mover->DrawRec, GetChunkRec(Index))) {
+                auto& Items{Beneath[Index].Items};
+                Items.erase(std::remove(Items.begin(), Items.end(), Mover->Item), Items.end());
+                Beneath[Index].Dirty = true;
+            }
+        }
+        Mover = Movers.erase(Mover);
+    }
+
+    Rectangle View{GetView(CharacterWorldPos)};
+    Refresh(Beneath, View);
+    Refresh(Above, View);
+}
+
+void BakedLayer::DrawBeneath(RenderQueue& Queue, const RenderLayer Layer, const Vector2 CharacterWorldPos) const
+{
+    Draw(Beneath, Queue, Layer, CharacterWorldPos);
+}
+
+void BakedLayer::DrawAbove(RenderQueue& Queue, const RenderLayer Layer, const Vector2 CharacterWorldPos) const
+{
+    Draw(Above, Queue, Layer, CharacterWorldPos);
+
+    // Their first draw came before the above chunks, this one puts them back on top
+    for (auto Item:Trailing) {
+        if (!Item->IsBaked()) {
+            Item->Draw(Queue, Layer, CharacterWorldPos);
+        }
+    }
+}
+
+void BakedLayer::Add(std::vector<Chunk>& Chunks, Prop& Item)
+{
+    Rectangle Rec{Item.GetDrawRec()};
+    int Left{static_cast<int>(Rec.x) / ChunkSize};
+    int Top{static_cast<int>(Rec.y) / ChunkSize};
+    int Right{std::min(Columns - 1, static_cast<int>(Rec.x + Rec.width) / ChunkSize)};
+    int Bottom{std::min(Rows - 1, static_cast<int>(Rec.y + Rec.height) / ChunkSize)};
+
+    for (int Y{Top}; Y <= Bottom; ++Y) {
+        for (int X{Left}; X <= Right; ++X) {
+            Chunks[Y * Columns + X].Items.push_back(&Item);
+        }
+    }
+}
+
+void BakedLayer::Refresh(std::vector<Chunk>& Chunks, const Rectangle View)
+{
+    // Dirty chunks are baked lazily, only once they come near the camera
+    for (int Index{}; Index < static_cast<int>(Chunks.size()); ++Index) {
+        Chunk& Slot{Chunks[Index]};
+        Rectangle Rec{GetChunkRec(Index)};
+
+        if (Slot.Dirty && (!Slot.Items.empty() || Slot.Target.id > 0) && CheckCollisionRecs(View, Rec)) {
+            Bake(Slot, Vector2{Rec.x, Rec.y});
+        }
+    }
+}
+
+void BakedLayer::Draw(const std::vector<Chunk>& Chunks, RenderQueue& Queue, const RenderLayer Layer, const Vector2 CharacterWorldPos) const
+{
+    Rectangle View{GetView(CharacterWorldPos)};
+    for (int Index{}; Index < static_cast<int>(Chunks.size()); ++Index) {
+        const Chunk& Slot{Chunks[Index]};
+        Rectangle Rec{GetChunkRec(Index)};
+
+        if (Slot.Target.id > 0 && !Slot.Dirty && CheckCollisionRecs(View, Rec)) {
+            // Render textures come out upside down, hence the negative source height
+            Rectangle Source{0.f, 0.f, Rec.width, -Rec.height};
+            Rectangle Dest{Rec.x - CharacterWorldPos.x, Rec.y - CharacterWorldPos.y, Rec.width, Rec.height};
+            Queue.Submit(Layer, Slot.Target.texture, Source, Dest, WHITE);
+        }
+    }
+}
+
+void BakedLayer::Bake(Chunk& Slot, const Vector2 Origin)
+{
+    if (Slot.Target.id == 0) {
+        Slot.Target = LoadRenderTexture(ChunkSize, ChunkSize);
+    }
+
+    BeginTextureMode(Slot.Target);
+    ClearBackground(BLANK);
+    for (auto Item:Slot.Items) {
+        Item->DrawSprite(Origin);
+    }
+    EndTextureMode();
+
+    Slot.Dirty = false;
+}
+
+Rectangle BakedLayer::GetView(const Vector2 CharacterWorldPos) const
+{
+    // Props draw at WorldPos - CharacterWorldPos, so the screen covers this much of the world
+    return Rectangle{
+        CharacterWorldPos.x - CullMargin,
+        CharacterWorldPos.y - CullMargin,
+        Platform::GetScreenWidth() + CullMargin * 2.f,
+        Platform::GetScreenHeight() + CullMargin * 2.f
+    };
+}
+
+Rectangle BakedLayer::GetChunkRec(const int Index) const
+{
+    return Rectangle{
+        static_cast<float>((Index % Columns) * ChunkSize),
+        static_cast<float>((Index / Columns) * ChunkSize),
+        static_cast<float>(ChunkSize),
+        static_cast<float>(ChunkSize)
+    };
+}
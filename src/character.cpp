@@ -33,8 +33,10 @@ Character::Character(const Sprite& Idle,
     SpriteIndex = static_cast<int>(FoxState::IDLE);
 }
 
-void Character::Tick(float DeltaTime, Props& Props, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Character::Tick(float DeltaTime, Props& Props, std::vector<Enemy>& Enemies)
 {
+    Profiler::Scope Timer{Profiler::Zone::CHARACTER_TICK};
+
     UpdateScreenPos();
 
     SpriteTick(DeltaTime);
@@ -48,7 +50,7 @@ void Character::Tick(float DeltaTime, Props& Props, std::vector<Enemy>& Enemies,
 
         CheckAttack();
 
-        CheckMovement(Props, Enemies, Trees);
+        CheckMovement(Props, Enemies);
 
         CheckEmotion();
 
@@ -69,9 +71,12 @@ void Character::Tick(float DeltaTime, Props& Props, std::vector<Enemy>& Enemies,
     }
 }
 
-void Character::Draw()
+// The fox stays in the middle of the screen while the rest of the world is drawn through the
+// camera, so it is shifted back by the camera offset to land in the same spot
+void Character::Draw(RenderQueue& Queue, const Vector2 CameraOffset)
 {
-    DrawTexturePro(Sprites.at(SpriteIndex).Texture, Source, Destination, Vector2{}, 0.f, WHITE);
+    Rectangle Shifted{Destination.x - CameraOffset.x, Destination.y - CameraOffset.y, Destination.width, Destination.height};
+    Queue.Submit(RenderLayer::WORLD, Sprites.at(SpriteIndex).Texture, Source, Shifted, WHITE);
 }
 
 void Character::SpriteTick(float DeltaTime)
@@ -98,10 +103,10 @@ void Character::CheckDirection()
 {
     if (!Locked)
     {
-        if (IsKeyDown(KEY_W)) Face = Direction::UP;
-        if (IsKeyDown(KEY_A)) Face = Direction::LEFT;
-        if (IsKeyDown(KEY_S)) Face = Direction::DOWN;
-        if (IsKeyDown(KEY_D)) Face = Direction::RIGHT;
+        if (Platform::IsKeyDown(KEY_W)) Face = Direction::UP;
+        if (Platform::IsKeyDown(KEY_A)) Face = Direction::LEFT;
+        if (Platform::IsKeyDown(KEY_S)) Face = Direction::DOWN;
+        if (Platform::IsKeyDown(KEY_D)) Face = Direction::RIGHT;
     }
 
         switch (Face)
@@ -121,7 +126,7 @@ void Character::CheckDirection()
         }
 }
 
-void Character::CheckMovement(Props& Props, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Character::CheckMovement(Props& Props, std::vector<Enemy>& Enemies)
 {
     PrevWorldPos = WorldPos;
     Vector2 Direction{};
@@ -130,16 +135,16 @@ void Character::CheckMovement(Props& Props, std::vector<Enemy>& Enemies, std::ve
     // Check for movement input
     if (!Locked) {
 
-        if (IsKeyDown(KEY_W)) {
+        if (Platform::IsKeyDown(KEY_W)) {
             Direction.y -= Speed;
         }
-        if (IsKeyDown(KEY_A)) {
+        if (Platform::IsKeyDown(KEY_A)) {
             Direction.x -= Speed;
         }
-        if (IsKeyDown(KEY_S)) {
+        if (Platform::IsKeyDown(KEY_S)) {
             Direction.y += Speed;
         }
-        if (IsKeyDown(KEY_D)) {
+        if (Platform::IsKeyDown(KEY_D)) {
             Direction.x += Speed;
         }
 
@@ -151,8 +156,19 @@ void Character::CheckMovement(Props& Props, std::vector<Enemy>& Enemies, std::ve
         if (World.GetArea() == Area::FOREST) {
             CheckOutOfBounds();
 
-            CheckCollision(Props.Under, Direction, Enemies, Trees);
-            CheckCollision(Props.Over, Direction, Enemies, Trees);
+            // Nothing is under the character until the prop scans below say otherwise
+            if (Collidable) {
+                Interactable = false;
+                Colliding = false;
+            }
+
+            // Static scenery and trees are baked into one mask, so a single test covers them all
+            if (Collidable && Props.StaticMask.IsBlocked(GetWorldCollisionRec())) {
+                UndoMovement();
+            }
+
+            CheckCollision(Props.UnderGrid, Props.StaticMask, Direction, Enemies);
+            CheckCollision(Props.OverGrid, Props.StaticMask, Direction, Enemies);
         }
         else if (World.GetArea() == Area::DUNGEON) {
             CheckOutOfBounds();
@@ -192,98 +208,91 @@ void Character::CheckOutOfBounds()
     }
 }
 
-void Character::CheckCollision(std::vector<std::vector<Prop>>& Props, const Vector2 Direction, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Character::CheckCollision(SpatialGrid<Prop>& Grid, const CollisionMask& Mask, const Vector2 Direction, std::vector<Enemy>& Enemies)
 {
-    DamageTime += GetFrameTime();
+    DamageTime += Platform::GetFrameTime();
     
     if (Collidable) {
-        // Loop through all Props for collision
-        for (auto& PropType:Props) {
-            for (auto& Prop:PropType) {
-                if (Prop.HasCollision()) {   
-                     
-                    if (Prop.IsFinalAct()) {
-                        FinalAct = true;
-                    }
+        if (Prop::IsFinalAct()) {
+            FinalAct = true;
+        }
 
-                    // check physical collision
-                    if (CheckCollisionRecs(GetCollisionRec(), Prop.GetCollisionRec(WorldPos))) {   
-                        
-                        // manage pushable props
-                        if (Prop.IsMoveable()) {
-                            if (Prop.GetType() == PropType::BOULDER) {
-                                Colliding = true; 
-                                PushingAudio();
-                                if(!Prop.IsOutOfBounds()) {
-                                    if (Prop.CheckMovement(World, WorldPos, Direction, Speed, Props)) {
-                                        UndoMovement();
-                                    }
-                                }
-                                else {
-                                    UndoMovement();
-                                }
-                            }
-                            if (Prop.GetType() == PropType::GRASS) {
-                                Prop.SetActive(true);
+        // Cover both where the character is and where UndoMovement() would put it back
+        Rectangle Area{GetWorldCollisionRec()};
+        Area.x += std::min(0.f, PrevWorldPos.x - WorldPos.x);
+        Area.y += std::min(0.f, PrevWorldPos.y - WorldPos.y);
+        Area.width += std::abs(PrevWorldPos.x - WorldPos.x);
+        Area.height += std::abs(PrevWorldPos.y - WorldPos.y);
+
+        // Only props sharing a grid cell with the character can touch it
+        for (auto Nearby:Grid.Query(Area)) {
+            auto& Prop{*Nearby};
+            // check physical collision
+            if (CheckCollisionRecs(GetWorldCollisionRec(), Prop.GetWorldCollisionRec())) {   
+                
+                // manage pushable props
+                if (Prop.IsMoveable()) {
+                    if (Prop.GetType() == PropType::BOULDER) {
+                        Colliding = true; 
+                        PushingAudio();
+                        if(!Prop.IsOutOfBounds()) {
+                            if (Prop.CheckMovement(World, Direction, Speed, Grid, Mask)) {
+                                UndoMovement();
                             }
+                            Grid.Move(Prop, Prop.GetWorldBounds());
                         }
-                        // if not pushable, block movement   
                         else {
-                            if (Prop.IsSpawned()) {
-                                UndoMovement();
-                            }
+                            UndoMovement();
                         }
                     }
-                    else {
-                        Prop.SetActive(false);
+                    if (Prop.GetType() == PropType::GRASS) {
+                        Prop.SetActive(true);
                     }
+                }
+                // if not pushable, block movement   
+                else {
+                    if (Prop.IsSpawned()) {
+                        UndoMovement();
+                    }
+                }
+            }
+            else {
+                Prop.SetActive(false);
+            }
 
-                    // check interactable collision
-                    if (Prop.IsInteractable() && Prop.IsSpawned() && (CheckCollisionRecs(GetCollisionRec(), Prop.GetInteractRec(WorldPos)))) {
-                        // Check for interact collision to display ! over character
-                        Interactable = true;
-
-                        // Manage interacting with props
-                        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) || IsKeyPressed(KEY_SPACE)) {
-                            Interacting = true;
-                        }
-                                
-                        if (Interacting) {
-                            Prop.SetActive(true);
-                            Interactable = false;
-                            Locked = true;
-                        }
+            // check interactable collision
+            if (Prop.IsInteractable() && Prop.IsSpawned() && (CheckCollisionRecs(GetWorldCollisionRec(), Prop.GetWorldInteractRec()))) {
+                // Check for interact collision to display ! over character
+                Interactable = true;
 
-                        if (Prop.IsOpened()) {
-                            Interacting = false;
-                            Interactable = false;
-                            Prop.SetActive(false);
-                            Locked = false;
-
-                            // Make NPCs & Props interactable again
-                            if (Prop.GetType() == PropType::NPC_DIANA || Prop.GetType() == PropType::NPC_JADE || 
-                                Prop.GetType() == PropType::NPC_SON || Prop.GetType() == PropType::NPC_RUMBY ||
-                                Prop.GetType() == PropType::ANIMATEDALTAR || Prop.GetType() == PropType::STUMP) 
-                            {
-                                Prop.SetOpened(false);
-                            }
-                        }
-                    }
+                // Manage interacting with props
+                if (Platform::IsMouseButtonPressed(MOUSE_BUTTON_LEFT) || Platform::IsKeyPressed(KEY_SPACE)) {
+                    Interacting = true;
                 }
-                else {
+                        
+                if (Interacting) {
+                    Prop.SetActive(true);
                     Interactable = false;
-                    Colliding = false;
+                    Locked = true;
                 }
-            }
-        }
 
-        // Loop for tree collision
-        for (auto& Tree:Trees) {
-            if (Tree.HasCollision() && Tree.IsSpawned() && (CheckCollisionRecs(GetCollisionRec(), Tree.GetCollisionRec(WorldPos)))) {
-                UndoMovement();
+                if (Prop.IsOpened()) {
+                    Interacting = false;
+                    Interactable = false;
+                    Prop.SetActive(false);
+                    Locked = false;
+
+                    // Make NPCs & Props interactable again
+                    if (Prop.GetType() == PropType::NPC_DIANA || Prop.GetType() == PropType::NPC_JADE || 
+                        Prop.GetType() == PropType::NPC_SON || Prop.GetType() == PropType::NPC_RUMBY ||
+                        Prop.GetType() == PropType::ANIMATEDALTAR || Prop.GetType() == PropType::STUMP) 
+                    {
+                        Prop.SetOpened(false);
+                    }
+                }
             }
         }
-        
+
         // Loop through all Enemies for collision
         for (auto& Enemy:Enemies) {
 
@@ -342,7 +351,7 @@ void Character::CheckCollision(std::vector<std::vector<Prop>>& Props, const Vect
 
 void Character::CheckCollision(std::vector<Enemy>& Enemies)
 {
-    DamageTime += GetFrameTime();
+    DamageTime += Platform::GetFrameTime();
 
     if (Collidable) {
         // Loop through all Enemies for collision
@@ -404,7 +413,7 @@ void Character::CheckCollision(std::vector<Enemy>& Enemies)
 
 void Character::WalkOrRun()
 {
-    if (IsKeyDown(KEY_LEFT_SHIFT)) {
+    if (Platform::IsKeyDown(KEY_LEFT_SHIFT)) {
         Running = true;
         if (Colliding) {
             Speed = 0.9f;
@@ -423,7 +432,7 @@ void Character::WalkOrRun()
         }
     }
 
-    if (IsKeyDown(KEY_W) || IsKeyDown(KEY_A) || IsKeyDown(KEY_S) || IsKeyDown(KEY_D)) {
+    if (Platform::IsKeyDown(KEY_W) || Platform::IsKeyDown(KEY_A) || Platform::IsKeyDown(KEY_S) || Platform::IsKeyDown(KEY_D)) {
         Walking = true;
         Sleeping = false;
     }
@@ -447,10 +456,10 @@ void Character::WalkOrRun()
 
 void Character::CheckAttack()
 {
-    AttackTime += GetFrameTime();
+    AttackTime += Platform::GetFrameTime();
 
     if (!Locked) {
-        if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsKeyDown(KEY_SPACE)) {
+        if (Platform::IsMouseButtonDown(MOUSE_BUTTON_LEFT) || Platform::IsKeyDown(KEY_SPACE)) {
 
             float AttackResetTime{0.7f};
 
@@ -484,7 +493,7 @@ void Character::CheckSleep()
 {
     if (Sleeping) {
 
-        float DeltaTime{GetFrameTime()};
+        float DeltaTime{Platform::GetFrameTime()};
         float UpdateTime{2.f/1.f};
         RunningTime += DeltaTime;    
 
@@ -555,6 +564,15 @@ Rectangle Character::GetCollisionRec()
     };
 }
 
+Rectangle Character::GetWorldCollisionRec()
+{
+    // Screen space is world space shifted by WorldPos, so undo the shift
+    Rectangle Collision{GetCollisionRec()};
+    Collision.x += WorldPos.x;
+    Collision.y += WorldPos.y;
+    return Collision;
+}
+
 Rectangle Character::GetAttackRec()
 {
     float CurrentSpriteWidth{static_cast<float>(Sprites.at(SpriteIndex).Texture.width/Sprites.at(SpriteIndex).MaxFramesX)};
@@ -731,7 +749,7 @@ void Character::AttackAudio()
 void Character::DamageAudio()
 {
     SetSoundVolume(Audio.FoxAttack, 0.2f);
-    DamageAudioTime += GetFrameTime();
+    DamageAudioTime += Platform::GetFrameTime();
 
     if (DamageAudioTime >= 0.7f) {
         PlaySoundMulti(Audio.ImpactMedium);
@@ -742,13 +760,13 @@ void Character::DamageAudio()
 void Character::WalkingAudio()
 {
     SetSoundVolume(Audio.Walking, 0.2f);
-    WalkingAudioTime += GetFrameTime();
+    WalkingAudioTime += Platform::GetFrameTime();
 
     if (Walking && WalkingAudioTime >= 1.f/3.f) {
         PlaySoundMulti(Audio.Walking);
         WalkingAudioTime = 0.f;
     }
-    else if (Walking && IsKeyDown(KEY_LEFT_SHIFT) && WalkingAudioTime >= 1.f/3.5f) {
+    else if (Walking && Platform::IsKeyDown(KEY_LEFT_SHIFT) && WalkingAudioTime >= 1.f/3.5f) {
         PlaySoundMulti(Audio.Walking);
         WalkingAudioTime = 0.f;
     }
@@ -757,7 +775,7 @@ void Character::WalkingAudio()
 void Character::PushingAudio()
 {
     SetSoundVolume(Audio.Pushing, 0.7f);
-    PushingAudioTime += GetFrameTime();
+    PushingAudioTime += Platform::GetFrameTime();
 
     if (Colliding && PushingAudioTime >= 1.f) {
         PlaySoundMulti(Audio.Pushing);
@@ -781,7 +799,7 @@ void Character::AddHealth(float HP)
 void Character::HealOverTime(float HP, float TimeToHeal)
 {   
     // Gradually heal fox when killing an enemy
-    HealTime += GetFrameTime();
+    HealTime += Platform::GetFrameTime();
     static float StopHealing{HP};
 
     if (StopHealing >= HP) {
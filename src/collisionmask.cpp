@@ -0,0 +1,93 @@
+#include "collisionmask.hpp"
+#include <algorithm>
+#include <cmath>
+
+CollisionMask::CollisionMask(const Vector2 WorldSize, const int CellSize)
+    : CellSize{CellSize},
+      Columns{static_cast<int>(std::ceil(WorldSize.x / CellSize))},
+      Rows{static_cast<int>(std::ceil(WorldSize.y / CellSize))},
+      WordsPerRow{(Columns + 63) / 64},
+      Bits(WordsPerRow * Rows)
+{
+
+}
+
+void CollisionMask::Add(const Rectangle Rec)
+{
+    Span Cells{GetSpan(Rec)};
+
+    for (int Y = Cells.Top; Y <= Cells.Bottom; ++Y) {
+        for (int X = Cells.Left; X <= Cells.Right; ++X) {
+            Set(X, Y);
+        }
+    }
+}
+
+void CollisionMask::Clear()
+{
+    std::fill(Bits.begin(), Bits.end(), 0);
+}
+
+// Only accepts words baked for a mask of the same dimensions. Copies into the buffer the mask
+// already owns rather than allocating a second one.
+bool CollisionMask::Import(std::span<const std::uint64_t> BakedBits)
+{
+    if (BakedBits.size() != Bits.size()) {
+        return false;
+    }
+
+    std::copy(BakedBits.begin(), BakedBits.end(), Bits.begin());
+    return true;
+}
+
+bool CollisionMask::IsBlocked(const Rectangle Rec) const
+{
+    Span Cells{GetSpan(Rec)};
+
+    if (Cells.Left > Cells.Right || Cells.Top > Cells.Bottom) {
+        return false;
+    }
+
+    int FirstWord{Cells.Left / 64};
+    int LastWord{Cells.Right / 64};
+
+    // Test a whole row of the span a word at a time instead of bit by bit
+    for (int Y = Cells.Top; Y <= Cells.Bottom; ++Y) {
+        const std::uint64_t* Row{&Bits[Y * WordsPerRow]};
+
+        for (int Word = FirstWord; Word <= LastWord; ++Word) {
+            int Low{Word == FirstWord ? Cells.Left % 64 : 0};
+            int High{Word == LastWord ? Cells.Right % 64 : 63};
+            std::uint64_t Mask{(~std::uint64_t{0} >> (63 - High)) & (~std::uint64_t{0} << Low)};
+
+            if (Row[Word] & Mask) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+CollisionMask::Span CollisionMask::GetSpan(const Rectangle Rec) const
+{
+    // Cells touched by the inside of the rectangle; edges that only meet a cell border don't count,
+    // the same way CheckCollisionRecs() ignores rectangles that merely touch
+    Span Cells{
+        static_cast<int>(std::floor(Rec.x / CellSize)),
+        static_cast<int>(std::floor(Rec.y / CellSize)),
+        static_cast<int>(std::ceil((Rec.x + Rec.width) / CellSize)) - 1,
+        static_cast<int>(std::ceil((Rec.y + Rec.height) / CellSize)) - 1
+    };
+
+    Cells.Left = std::max(Cells.Left, 0);
+    Cells.Top = std::max(Cells.Top, 0);
+    Cells.Right = std::min(Cells.Right, Columns - 1);
+    Cells.Bottom = std::min(Cells.Bottom, Rows - 1);
+
+    return Cells;
+}
+
+void CollisionMask::Set(const int X, const int Y)
+{
+    Bits[Y * WordsPerRow + X / 64] |= std::uint64_t{1} << (X % 64);
+}
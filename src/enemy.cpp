@@ -13,6 +13,14 @@ std::unordered_map<EnemyType, int> Enemy::MonsterCounter
     {EnemyType::BOSS, 0} 
 };
 
+const std::unordered_map<EnemyType, ItemId> Enemy::BossRewards
+{
+    {EnemyType::CREATURE, ItemId::TOP_RIGHT_ALTAR},
+    {EnemyType::IMP, ItemId::TOP_ALTAR},
+    {EnemyType::BEHOLDER, ItemId::BOTTOM_ALTAR},
+    {EnemyType::NECROMANCER, ItemId::BOTTOM_RIGHT_ALTAR}
+};
+
 Enemy::Enemy(const Sprite& Idle,
              const Sprite& Walk,
              const Sprite& Attack,
@@ -81,6 +89,7 @@ Enemy::Enemy(const Sprite& Idle,
     MoveXRange = RandomEngine.Randomize(RandomRange);
     MoveYRange = RandomEngine.Randomize(RandomRange);
     LeftOrRight = RandomEngine.Randomize(RandomLeftRight);
+    NextActionState = RandomEngine.Randomize(RandomActionState);
 }
 
 Enemy::Enemy(const Sprite& NpcIdle,
@@ -119,79 +128,153 @@ Enemy::Enemy(const Sprite& NpcIdle,
     MoveYRange = RandomEngine.Randomize(RandomRange);
     LeftOrRight = RandomEngine.Randomize(RandomLeftRight);
     ActionState = RandomEngine.Randomize(RandomActionState);
+    NextActionState = RandomEngine.Randomize(RandomActionState);
 }
 
-void Enemy::Tick(float DeltaTime, Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Enemy::Tick(float DeltaTime, const int Steps, const Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, const EnemyHotState& Enemies, GameEvents& Events)
 {   
+    {
+        Profiler::Scope Timer{Profiler::Zone::ENEMY_THINK};
+        Think(DeltaTime, Steps, Props, HeroWorldPos, HeroScreenPos, Enemies);
+    }
+
+    Profiler::Scope Timer{Profiler::Zone::ENEMY_APPLY};
+    Apply(HeroWorldPos, Events);
+}
+
+// The part of a tick that only writes this enemy, so any number of enemies can think at once on
+// the job system. Props, trees and the hot state are only read here; anything touching shared
+// state is left in Pending for Apply().
+void Enemy::Think(float DeltaTime, const int Steps, const Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, const EnemyHotState& Enemies)
+{
+    ClearRequests();
+    WasAlive = Alive;
+
     UpdateScreenPos(HeroWorldPos);
-            
-    if (Visible) {
+
+    // Steps is how many fixed steps this update covers, 0 when the scheduler skips the enemy
+    if (Steps > 0) {
+        float Elapsed{DeltaTime * Steps};
+
         if (Type != EnemyType::NPC) {
             if (Alive && Summoned) {
-                SpriteTick(DeltaTime);
+                SpriteTick(Elapsed);
                 CheckDirection();
                 NeutralAction();
                 TakeDamage();
-                CheckAlive(DeltaTime);
+                CheckAlive(Elapsed);
             }
         }
         else {
-            SpriteTick(DeltaTime);
+            SpriteTick(Elapsed);
             CheckDirection();
             NeutralAction();
         }
 
         if (Summoned) {
-            CheckMovement(Props, HeroWorldPos, HeroScreenPos, Enemies, Trees);
+            CheckMovement(Props, HeroWorldPos, HeroScreenPos, Enemies, Steps);
         }
     }
-    else {
+}
+
+// Carries out what Think() requested, on the main thread and in enemy order so the outcome is the
+// same however the thinking was spread across threads
+void Enemy::Apply(const Vector2 HeroWorldPos, GameEvents& Events)
+{
+    for (auto* Grass:Pending.Grass) {
+        Grass->SetActive(true);
+    }
+
+    if (Pending.RollAction) {
+        NextActionState = RandomEngine.Randomize(RandomActionState);
+    }
+
+    if (Pending.DamageSound) {
+        DamageAudio();
+    }
+
+    if (Pending.AttackSound) {
+        if (Ranged) {
+            SetSoundVolume(Audio.MonsterRangedAttack, 0.7f);
+            PlaySoundMulti(Audio.MonsterRangedAttack);
+        }
+        else {
+            SetSoundVolume(Audio.MonsterAttack, 0.7f);
+            PlaySoundMulti(Audio.MonsterAttack);
+        }
+    }
+
+    if (Pending.DeathSound) {
+        DeathAudio();
+    }
+
+    // Summoning is an event, so bosses listen for it whatever their tier
+    if ((Type == EnemyType::BOSS || Type == EnemyType::FINALBOSS) && !Summoned && !WithinScreen(HeroWorldPos)) {
+        CheckBossSummon(HeroWorldPos);
+    }
+
+    if (WasAlive && !Alive) {
+        MonsterDeaths += 1;
+        if (Type != EnemyType::BOSS) {
+            MonsterCounter[Race] -= 1;
+        }
+        else {
+            MonsterCounter[EnemyType::BOSS] -= 1;
+        }
+
+        // A boss going down is announced once, for its reward chest to spawn
         if (Type == EnemyType::BOSS || Type == EnemyType::FINALBOSS) {
-            CheckBossSummon(HeroWorldPos);
+            Events.Publish(GameEvent{GameEventType::BOSS_DEFEATED, Race});
         }
     }
-    CheckSpawnChest(Props.Over);
 }
 
-void Enemy::Draw(const Vector2 HeroWorldPos)
+// Keeps the grass buffer, every enemy refills it each step
+void Enemy::ClearRequests()
 {
-    if (WithinScreen(HeroWorldPos)) {
-        Visible = true;
+    Pending.Grass.clear();
+    Pending.RollAction = false;
+    Pending.AttackSound = false;
+    Pending.DamageSound = false;
+    Pending.DeathSound = false;
+}
 
+void Enemy::Draw(RenderQueue& Queue, const RenderLayer Layer, const Vector2 HeroWorldPos)
+{
+    CheckVisibility(HeroWorldPos);
+
+    if (Visible) {
         if (!OOB) {
             if (Type == EnemyType::NORMAL || Type == EnemyType::NPC || (Type == EnemyType::BOSS && Summoned) || (Type == EnemyType::FINALBOSS && Summoned)) {
                 if (Hurting) {
-                    DrawTexturePro(Sprites.at(CurrentSpriteIndex).Texture, Sprites.at(CurrentSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), Vector2{},0.f, RED);
+                    Queue.Submit(Layer, Sprites.at(CurrentSpriteIndex).Texture, Sprites.at(CurrentSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), RED);
                 }
                 else {
-                    DrawTexturePro(Sprites.at(CurrentSpriteIndex).Texture, Sprites.at(CurrentSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), Vector2{},0.f, WHITE);
+                    Queue.Submit(Layer, Sprites.at(CurrentSpriteIndex).Texture, Sprites.at(CurrentSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), WHITE);
                 }
 
                 // Draw Ranged projectile
                 if (Ranged && Attacking && !Dying && !Hurting) {
                     if (Type == EnemyType::NORMAL) {
-                        DrawTexturePro(Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateProjectile(),Scale), Vector2{},0.f, WHITE);
+                        Queue.Submit(Layer, Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateProjectile(),Scale), WHITE);
                     }
                     else if (Type == EnemyType::BOSS || Type == EnemyType::FINALBOSS) {
-                        DrawTexturePro(Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateMultiProjectile().at(0),Scale), Vector2{},0.f, WHITE);
-                        DrawTexturePro(Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateMultiProjectile().at(1),Scale), Vector2{},0.f, WHITE);
-                        DrawTexturePro(Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateMultiProjectile().at(2),Scale), Vector2{},0.f, WHITE);
+                        Queue.Submit(Layer, Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateMultiProjectile().at(0),Scale), WHITE);
+                        Queue.Submit(Layer, Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateMultiProjectile().at(1),Scale), WHITE);
+                        Queue.Submit(Layer, Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateMultiProjectile().at(2),Scale), WHITE);
                     }
                 }
             }
         }
         // OOB is used for debugging purposes only
         else {
-            DrawTexturePro(Sprites.at(CurrentSpriteIndex).Texture, Sprites.at(CurrentSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), Vector2{},0.f, PURPLE);
+            Queue.Submit(Layer, Sprites.at(CurrentSpriteIndex).Texture, Sprites.at(CurrentSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), PURPLE);
         }
 
         if (Alive && Summoned && (Type != EnemyType::NPC)) {
-            DrawHP();
+            DrawHP(Queue);
         }
     }
-    else {
-        Visible = false;
-    }
 }
 
 void Enemy::SpriteTick(float DeltaTime)
@@ -301,12 +384,12 @@ void Enemy::CheckDirection()
     }
 }
 
-void Enemy::CheckMovement(Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Enemy::CheckMovement(const Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, const EnemyHotState& Enemies, const int Steps)
 {
     PrevWorldPos = WorldPos;
     
     if (Race != EnemyType::MUSHROOM) {
-        EnemyAI();
+        EnemyAI(Steps);
     }
 
     if (Type != EnemyType::NPC) {
@@ -316,8 +399,8 @@ void Enemy::CheckMovement(Props& Props, const Vector2 HeroWorldPos, const Vector
     CheckOutOfBounds();
 
     if (Alive && World.GetArea() == Area::FOREST) {
-        CheckCollision(Props.Under, HeroWorldPos, Enemies, Trees);
-        CheckCollision(Props.Over, HeroWorldPos, Enemies, Trees);
+        CheckCollision(Props, HeroWorldPos);
+        CheckSeparation(Enemies);
     }
 }
 
@@ -382,57 +465,87 @@ void Enemy::NeutralAction()
     }
 }
 
-void Enemy::CheckCollision(std::vector<std::vector<Prop>>& Props, const Vector2 HeroWorldPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Enemy::CheckCollision(const Props& Props, const Vector2 HeroWorldPos)
 {
     // Crows should not be blocked by anything
     if (Race != EnemyType::CROW) {
-
-        // Prop collision handling
-        for (auto& PropType:Props) {
-            for (auto& Prop:PropType) {
-                if (Prop.HasCollision() && Prop.IsSpawned()) { 
+        Vector2 RadiusAroundEnemy{5.f,5.f};
+        Rectangle Body{GetCollisionRec()};
+
+        // Steering only reacts to colliders whose corner is within MinRange, and grass to the body
+        // touching it, so nothing outside this area can matter
+        Rectangle Area{WorldPos.x - RadiusAroundEnemy.x - MinRange, WorldPos.y - RadiusAroundEnemy.y - MinRange, MinRange * 2.f, MinRange * 2.f};
+        float Right{std::max(Area.x + Area.width, Body.x + HeroWorldPos.x + Body.width)};
+        float Bottom{std::max(Area.y + Area.height, Body.y + HeroWorldPos.y + Body.height)};
+        Area.x = std::min(Area.x, Body.x + HeroWorldPos.x);
+        Area.y = std::min(Area.y, Body.y + HeroWorldPos.y);
+        Area.width = Right - Area.x;
+        Area.height = Bottom - Area.y;
+
+        // Grass, chests and anything else that can change, layer by layer
+        for (auto* Grid:{&Props.UnderGrid, &Props.OverGrid}) {
+            Grid->Query(Area, QueryScratch, Nearby);
+
+            for (auto* Prop:Nearby) {
+                if (Prop->HasCollision() && Prop->IsSpawned()) { 
                     // move away from props
-                    Vector2 PropScreenPos{Vector2{Prop.GetCollisionRec(HeroWorldPos).x, Prop.GetCollisionRec(HeroWorldPos).y}}; // Grab the collision rectangle screen position
-                    Vector2 RadiusAroundEnemy{5.f,5.f};
+                    Rectangle PropRec{Prop->GetCollisionRec(HeroWorldPos)};
+                    Vector2 PropScreenPos{Vector2{PropRec.x, PropRec.y}}; // Grab the collision rectangle screen position
                     Vector2 ToTarget {Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(PropScreenPos, RadiusAroundEnemy), ScreenPos)), Speed)}; // Calculate the distance from Enemy to Prop
                     float AvoidProp{Vector2Length(Vector2Subtract(Vector2Add(PropScreenPos, RadiusAroundEnemy), ScreenPos))};
                     
-                    if (AvoidProp <= MinRange && Prop.GetType() != PropType::GRASS) {
+                    if (AvoidProp <= MinRange && Prop->GetType() != PropType::GRASS) {
                         WorldPos = Vector2Subtract(WorldPos, ToTarget);
                     }
 
                     // activate grass animation
-                    if (CheckCollisionRecs(this->GetCollisionRec(), Prop.GetCollisionRec(HeroWorldPos)) && Prop.GetType() == PropType::GRASS && Alive) {   
-                        Prop.SetActive(true);
+                    if (CheckCollisionRecs(Body, PropRec) && Prop->GetType() == PropType::GRASS && Alive) {   
+                        Pending.Grass.push_back(Prop);
                     }
                 }
             }
         }
-        
-        // Tree collision handling
-        for (auto& Tree:Trees) {
-            if (Tree.HasCollision() && Tree.IsSpawned()) {
-                Vector2 TreeScreenPos{Vector2{Tree.GetCollisionRec(HeroWorldPos).x, Tree.GetCollisionRec(HeroWorldPos).y}}; // Grab the collision rectangle screen position
-                Vector2 RadiusAroundEnemy{5.f,5.f};
-                Vector2 ToTarget {Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(TreeScreenPos, RadiusAroundEnemy), ScreenPos)), Speed)}; // Calculate the distance from Enemy to Tree
-                float AvoidTree{Vector2Length(Vector2Subtract(Vector2Add(TreeScreenPos, RadiusAroundEnemy), ScreenPos))};
-                
-                if (AvoidTree <= MinRange) {
-                    WorldPos = Vector2Subtract(WorldPos, ToTarget);
-                }
+
+        // Rocks, trees and the rest of the scenery that never changes
+        Props.StaticGrid.Query(Area, QueryScratch, Nearby);
+        for (auto* Prop:Nearby) {
+            Rectangle PropRec{Prop->GetCollisionRec(HeroWorldPos)};
+            Vector2 PropScreenPos{Vector2{PropRec.x, PropRec.y}}; // Grab the collision rectangle screen position
+            Vector2 ToTarget {Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(PropScreenPos, RadiusAroundEnemy), ScreenPos)), Speed)}; // Calculate the distance from Enemy to Prop
+            float AvoidProp{Vector2Length(Vector2Subtract(Vector2Add(PropScreenPos, RadiusAroundEnemy), ScreenPos))};
+            
+            if (AvoidProp <= MinRange) {
+                WorldPos = Vector2Subtract(WorldPos, ToTarget);
             }
         }
     }
+}
+
+void Enemy::CheckSeparation(const EnemyHotState& Enemies)
+{
+    if (Type == EnemyType::BOSS || Dying) {
+        return;
+    }
+
+    // Only enemies bucketed near this one can be within MinRange
+    float Reach{MinRange + SeparationMargin};
+    Vector2 RadiusAroundEnemy{5.f,5.f};
 
     // Enemy collision handling
-    for (auto& Enemy:Enemies) {
-        if (this != &Enemy && (Type != EnemyType::BOSS) && (Enemy.GetType() != EnemyType::BOSS) && !Dying) {
-            Vector2 RadiusAroundEnemy{5.f,5.f};
-            Vector2 ToTarget{Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(Enemy.GetEnemyPos(), RadiusAroundEnemy), ScreenPos)), Speed)}; // Calculate the distance from this->Enemy to Enemy
-            float AvoidEnemy{Vector2Length(Vector2Subtract(Vector2Add(Enemy.GetEnemyPos(), RadiusAroundEnemy), ScreenPos))};
+    for (int Y = Enemies.CellY(WorldPos.y - Reach); Y <= Enemies.CellY(WorldPos.y + Reach); ++Y) {
+        for (int X = Enemies.CellX(WorldPos.x - Reach); X <= Enemies.CellX(WorldPos.x + Reach); ++X) {
+            int Cell{Y * Enemies.Columns + X};
 
-            if (AvoidEnemy <= MinRange) {
-                WorldPos = Vector2Subtract(WorldPos, ToTarget);
+            for (int Index = Enemies.CellStart[Cell]; Index < Enemies.CellStart[Cell + 1]; ++Index) {
+                if (Enemies.Owner[Index] != this) {
+                    Vector2 EnemyPos{Enemies.ScreenX[Index], Enemies.ScreenY[Index]};
+                    Vector2 ToTarget{Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(EnemyPos, RadiusAroundEnemy), ScreenPos)), Speed)}; // Calculate the distance from this->Enemy to Enemy
+                    float AvoidEnemy{Vector2Length(Vector2Subtract(Vector2Add(EnemyPos, RadiusAroundEnemy), ScreenPos))};
+
+                    if (AvoidEnemy <= MinRange) {
+                        WorldPos = Vector2Subtract(WorldPos, ToTarget);
+                    }
+                }
             }
         }
     }
@@ -541,7 +654,7 @@ std::array<Vector2,3> Enemy::UpdateMultiProjectile()
 
 void Enemy::TakeDamage()
 {
-    DamageTime += GetFrameTime();
+    DamageTime += Platform::GetFrameTime();
 
     if (IsAttacked) {
         float UpdateTime {0.7f};
@@ -576,7 +689,7 @@ void Enemy::TakeDamage()
         if (DamageTime <= HurtUpdateTime) {
             CurrentSpriteIndex = static_cast<int>(Monster::HURT);
             Hurting = true;
-            DamageAudio();
+            Pending.DamageSound = true;
             Trajectory = 1.f;
         }
 
@@ -597,7 +710,7 @@ void Enemy::TakeDamage()
 void Enemy::CheckAlive(float DeltaTime) 
 {
     if (Health <= 0) {
-        DeathAudio();
+        Pending.DeathSound = true;
         CurrentSpriteIndex = static_cast<int>(Monster::DEATH);
         // Amount of time needed for death animation to complete beginning to end
         float EndTime{1.35f};
@@ -606,20 +719,15 @@ void Enemy::CheckAlive(float DeltaTime)
 
         // Allow time for death animation to finish before setting alive=false which turns off SpriteTick()
         StopTime += DeltaTime;
+        // The kill counters are shared, Apply() updates them
         if (StopTime >= EndTime) {
-            MonsterDeaths += 1;
             Alive = false;
-            if (Type != EnemyType::BOSS) {
-                MonsterCounter[Race] -= 1;
-            }
-            else {
-                MonsterCounter[EnemyType::BOSS] -= 1;
-            }
         }
     }
 }
 
-void Enemy::EnemyAI()
+// Wandering covers Steps fixed steps at once for enemies the scheduler updates less often
+void Enemy::EnemyAI(const int Steps)
 {
     // Randomize which direction enemy will move first
     if (!InitializedAI) {
@@ -627,7 +735,7 @@ void Enemy::EnemyAI()
     } 
 
     if (!Chasing && !Blocked) {
-        ActionTime += GetFrameTime();
+        ActionTime += Platform::GetFrameTime() * Steps;
 
         if (ActionTime >= ActionIdleTime) {
             ActionTime = 0.0f;
@@ -635,7 +743,9 @@ void Enemy::EnemyAI()
             MiscAction = false;
             Sleeping = false;
             Walking = false;
-            ActionState = RandomEngine.Randomize(RandomActionState);
+            // Rolled ahead of time by Apply(), the shared engine can't be touched from here
+            ActionState = NextActionState;
+            Pending.RollAction = true;
         }
 
         if (Type == EnemyType::NPC) {
@@ -643,10 +753,10 @@ void Enemy::EnemyAI()
                 Walking = false;
             }
             else if ((ActionState >= 4 && ActionState <= 6) && (ActionTime <= ActionIdleTime)) {
-                CheckMovementAI();
+                CheckMovementAI(Steps);
                 Walking = true;
-                WorldPos.x += AIX;
-                WorldPos.y += AIY;
+                WorldPos.x += AIX * Steps;
+                WorldPos.y += AIY * Steps;
             }
             else if (ActionState == 7 && (ActionTime <= ActionIdleTime)) {
                 MiscAction = true;
@@ -657,11 +767,11 @@ void Enemy::EnemyAI()
         }
         // all other enemies
         else {
-            CheckMovementAI();  
+            CheckMovementAI(Steps);  
             if (ActionTime <= ActionIdleTime/2) {
                 Walking = true;
-                WorldPos.x += AIX;
-                WorldPos.y += AIY;
+                WorldPos.x += AIX * Steps;
+                WorldPos.y += AIY * Steps;
             }
             else {
                 Walking = false;
@@ -770,10 +880,10 @@ void Enemy::EnemyAggro(const Vector2 HeroScreenPos)
     }
 }
 
-void Enemy::CheckMovementAI()
+void Enemy::CheckMovementAI(const int Steps)
 {
-    Movement.x += AIX;
-    Movement.y += AIY;
+    Movement.x += AIX * Steps;
+    Movement.y += AIY * Steps;
 
     if (Movement.x <= -MoveXRange || Movement.x >= MoveXRange) {
         AIX = -AIX;
@@ -793,7 +903,8 @@ void Enemy::InitializeAI()
     InitializedAI = true;
 }
 
-void Enemy::DrawHP()
+// Health bars go over everything else in the world
+void Enemy::DrawHP(RenderQueue& Queue)
 {
     float LifeBarScale{2.f};
     float SingleBarWidth{static_cast<float>(GameTextures.LifebarLeftEmpty.width) * LifeBarScale};
@@ -809,29 +920,29 @@ void Enemy::DrawHP()
         if (i <= Health) {
             // far left of lifebar
             if (i == 1) {
-                DrawTextureEx(GameTextures.LifebarLeftFilled, LifeBarPos, 0.f, LifeBarScale, WHITE);
+                Queue.Submit(RenderLayer::OVERLAY, GameTextures.LifebarLeftFilled, LifeBarPos, LifeBarScale, WHITE);
             }
             // far right of lifebar
             else if (i == MaxHP) {
-                DrawTextureEx(GameTextures.LifebarRightFilled, LifeBarPos, 0.f, LifeBarScale, WHITE);
+                Queue.Submit(RenderLayer::OVERLAY, GameTextures.LifebarRightFilled, LifeBarPos, LifeBarScale, WHITE);
             }
             // middle of lifebar
             else {
-                DrawTextureEx(GameTextures.LifebarMiddleFilled, LifeBarPos, 0.f, LifeBarScale, WHITE);
+                Queue.Submit(RenderLayer::OVERLAY, GameTextures.LifebarMiddleFilled, LifeBarPos, LifeBarScale, WHITE);
             }
         }
         else {
             // far left of lifebar
             if (i == 1) {
-                DrawTextureEx(GameTextures.LifebarLeftEmpty, LifeBarPos, 0.f, LifeBarScale, WHITE);
+                Queue.Submit(RenderLayer::OVERLAY, GameTextures.LifebarLeftEmpty, LifeBarPos, LifeBarScale, WHITE);
             }
             // far right of lifebar
             else if (i == MaxHP) {
-                DrawTextureEx(GameTextures.LifebarRightEmpty, LifeBarPos, 0.f, 2.f, WHITE);
+                Queue.Submit(RenderLayer::OVERLAY, GameTextures.LifebarRightEmpty, LifeBarPos, 2.f, WHITE);
             }
             // middle of lifebar
             else {
-                DrawTextureEx(GameTextures.LifebarMiddleEmpty, LifeBarPos, 0.f, 2.f, WHITE);
+                Queue.Submit(RenderLayer::OVERLAY, GameTextures.LifebarMiddleEmpty, LifeBarPos, 2.f, WHITE);
             }
         }
         // add spacing between each bar
@@ -849,21 +960,10 @@ void Enemy::CheckBossSummon(const Vector2 HeroWorldPos)
     }
 }
 
-void Enemy::CheckSpawnChest(std::vector<std::vector<Prop>>& Props)
+ItemId Enemy::GetBossReward(const EnemyType Race)
 {
-    for (auto& OuterProp:Props) {
-        for (auto& Prop:OuterProp) {
-            if ((Type == EnemyType::BOSS || Type == EnemyType::FINALBOSS) && Prop.GetType() == PropType::TREASURE) {
-                if ((Race == EnemyType::CREATURE && !Alive && Prop.GetItemName() == "Top Right Altar Piece") || 
-                    (Race == EnemyType::IMP && !Alive && Prop.GetItemName() == "Top Altar Piece") || 
-                    (Race == EnemyType::BEHOLDER && !Alive && Prop.GetItemName() == "Bottom Altar Piece") ||
-                    (Race == EnemyType::NECROMANCER && !Alive && Prop.GetItemName() == "Bottom Right Altar Piece")) 
-                {
-                    Prop.SetSpawned(true);
-                }
-            }
-        }
-    }
+    auto Reward{BossRewards.find(Race)};
+    return Reward != BossRewards.end() ? Reward->second : ItemId::NONE;
 }
 
 Rectangle Enemy::GetCollisionRec()
@@ -993,10 +1093,10 @@ Rectangle Enemy::GetAttackRec()
 bool Enemy::WithinScreen(const Vector2 HeroWorldPos)
 {
     if (
-        (WorldPos.x >= (HeroWorldPos.x + 615.f) - (GetScreenWidth()/2 + (Sprites.at(CurrentSpriteIndex).Texture.width * Scale))) && 
-        (WorldPos.x <= (HeroWorldPos.x + 615.f) + (GetScreenWidth()/2 + (Sprites.at(CurrentSpriteIndex).Texture.width * Scale))) &&
-        (WorldPos.y >= (HeroWorldPos.y + 335.f) - (GetScreenHeight()/2 + (Sprites.at(CurrentSpriteIndex).Texture.height * Scale))) && 
-        (WorldPos.y <= (HeroWorldPos.y + 335.f) + (GetScreenHeight()/2 + (Sprites.at(CurrentSpriteIndex).Texture.height * Scale)))
+        (WorldPos.x >= (HeroWorldPos.x + 615.f) - (Platform::GetScreenWidth()/2 + (Sprites.at(CurrentSpriteIndex).Texture.width * Scale))) && 
+        (WorldPos.x <= (HeroWorldPos.x + 615.f) + (Platform::GetScreenWidth()/2 + (Sprites.at(CurrentSpriteIndex).Texture.width * Scale))) &&
+        (WorldPos.y >= (HeroWorldPos.y + 335.f) - (Platform::GetScreenHeight()/2 + (Sprites.at(CurrentSpriteIndex).Texture.height * Scale))) && 
+        (WorldPos.y <= (HeroWorldPos.y + 335.f) + (Platform::GetScreenHeight()/2 + (Sprites.at(CurrentSpriteIndex).Texture.height * Scale)))
        ) {
         return true;
     }
@@ -1009,7 +1109,7 @@ bool Enemy::WithinScreen(const Vector2 HeroWorldPos)
 void Enemy::WalkingAudio()
 {
     SetSoundVolume(Audio.Walking, 0.10f);
-    WalkingAudioTime += GetFrameTime();
+    WalkingAudioTime += Platform::GetFrameTime();
 
     if (Walking && WalkingAudioTime >= 1.f/3.f) {
         PlaySoundMulti(Audio.Walking);
@@ -1023,17 +1123,10 @@ void Enemy::WalkingAudio()
 
 void Enemy::AttackAudio()
 {
-    AttackAudioTime += GetFrameTime();
+    AttackAudioTime += Platform::GetFrameTime();
 
     if (AttackAudioTime >= 0.6f) {
-        if (Ranged) {
-            SetSoundVolume(Audio.MonsterRangedAttack, 0.7f);
-            PlaySoundMulti(Audio.MonsterRangedAttack);
-        }
-        else {
-            SetSoundVolume(Audio.MonsterAttack, 0.7f);
-            PlaySoundMulti(Audio.MonsterAttack);
-        }
+        Pending.AttackSound = true;
         AttackAudioTime = 0.f;
     }
 }
@@ -1052,4 +1145,64 @@ void Enemy::DeathAudio()
     else if (Type == EnemyType::BOSS || Type == EnemyType::FINALBOSS) {
         PlaySound(Audio.BossDeath);
     }
-}
\ No newline at end of file
+}
+
+// ---------------------------------------------------------------------
+
+EnemyHotState::EnemyHotState(const Vector2 WorldSize, const float CellSize)
+    : CellSize{CellSize},
+      Columns{std::max(1, static_cast<int>(std::ceil(WorldSize.x / CellSize)))},
+      Rows{std::max(1, static_cast<int>(std::ceil(WorldSize.y / CellSize)))},
+      CellStart(Columns * Rows + 1)
+{
+
+}
+
+void EnemyHotState::Build(const std::vector<Enemy>& Enemies)
+{
+    Cells.resize(Enemies.size());
+    std::fill(CellStart.begin(), CellStart.end(), 0);
+
+    // Count how many enemies land in each cell. Bosses are never pushed around, so leave them out
+    for (std::size_t Index = 0; Index < Enemies.size(); ++Index) {
+        const Enemy& Current{Enemies[Index]};
+
+        if (Current.GetType() == EnemyType::BOSS) {
+            Cells[Index] = -1;
+        }
+        else {
+            Cells[Index] = CellY(Current.GetWorldPos().y) * Columns + CellX(Current.GetWorldPos().x);
+            ++CellStart[Cells[Index] + 1];
+        }
+    }
+
+    for (std::size_t Cell = 1; Cell < CellStart.size(); ++Cell) {
+        CellStart[Cell] += CellStart[Cell - 1];
+    }
+
+    int Total{CellStart.back()};
+    ScreenX.resize(Total);
+    ScreenY.resize(Total);
+    Owner.resize(Total);
+
+    // Place each enemy in its cell's range, keeping the original order within a cell
+    Next.assign(CellStart.begin(), CellStart.end() - 1);
+    for (std::size_t Index = 0; Index < Enemies.size(); ++Index) {
+        if (Cells[Index] >= 0) {
+            int Slot{Next[Cells[Index]]++};
+            ScreenX[Slot] = Enemies[Index].GetEnemyPos().x;
+            ScreenY[Slot] = Enemies[Index].GetEnemyPos().y;
+            Owner[Slot] = &Enemies[Index];
+        }
+    }
+}
+
+int EnemyHotState::CellX(const float X) const
+{
+    return std::clamp(static_cast<int>(std::floor(X / CellSize)), 0, Columns - 1);
+}
+
+int EnemyHotState::CellY(const float Y) const
+{
+    return std::clamp(static_cast<int>(std::floor(Y / CellSize)), 0, Rows - 1);
+}
@@ -0,0 +1,91 @@
+#include "jobsystem.hpp"
+#include <algorithm>
+
+JobSystem::JobSystem(const int Threads)
+{
+    for (int Thread = 0; Thread < Threads; ++Thread) {
+        Workers.emplace_back([this] {Work();});
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> Guard{Lock};
+        Stopping = true;
+    }
+    Wake.notify_all();
+
+    for (auto& Worker:Workers) {
+        Worker.join();
+    }
+}
+
+void JobSystem::ParallelFor(const int Count, const int BatchSize, const std::function<void(int Begin, int End)>& Body)
+{
+    if (Count <= 0) {
+        return;
+    }
+
+    // Not worth waking anyone for a single batch
+    if (Workers.empty() || Count <= BatchSize) {
+        Body(0, Count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> Guard{Lock};
+        this->Body = &Body;
+        this->Count = Count;
+        this->BatchSize = std::max(1, BatchSize);
+        Batches = (Count + this->BatchSize - 1) / this->BatchSize;
+        NextBatch = 0;
+        Busy = static_cast<int>(Workers.size());
+        ++Generation;
+    }
+    Wake.notify_all();
+
+    RunBatches();
+
+    // Body lives on the caller's stack, so every worker has to be done with it before returning
+    std::unique_lock<std::mutex> Guard{Lock};
+    Idle.wait(Guard, [this] {return Busy == 0;});
+    this->Body = nullptr;
+}
+
+int JobSystem::GetDefaultThreads()
+{
+    return std::max(0, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+}
+
+void JobSystem::RunBatches()
+{
+    for (int Batch{NextBatch.fetch_add(1)}; Batch < Batches; Batch = NextBatch.fetch_add(1)) {
+        int Begin{Batch * BatchSize};
+        (*Body)(Begin, std::min(Count, Begin + BatchSize));
+    }
+}
+
+void JobSystem::Work()
+{
+    std::uint64_t Seen{};
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> Guard{Lock};
+            Wake.wait(Guard, [this, Seen] {return Stopping || Generation != Seen;});
+            if (Stopping) {
+                return;
+            }
+            Seen = Generation;
+        }
+
+        RunBatches();
+
+        {
+            std::lock_guard<std::mutex> Guard{Lock};
+            --Busy;
+        }
+        Idle.notify_all();
+    }
+}
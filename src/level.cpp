@@ -0,0 +1,362 @@
+#include "level.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+
+static_assert(std::endian::native == std::endian::little, "Level files are read in place and stored little-endian");
+
+LevelFile::LevelFile(const std::string& Path, const GameTexture& Textures)
+    : File{Path}
+{
+    Loaded = Validate(Textures);
+    if (!Loaded) {
+        std::fprintf(stderr, "Level %s is missing or corrupt\n", Path.c_str());
+    }
+}
+
+// Checks every offset, index, enum and image once so the loaders can trust the records
+bool LevelFile::Validate(const GameTexture& Textures)
+{
+    using namespace LevelFormat;
+
+    const unsigned char* Data{File.GetData()};
+    const std::uint64_t Size{File.GetSize()};
+    if (!Data || Size < sizeof(Header)) {
+        return false;
+    }
+
+    Head = reinterpret_cast<const Header*>(Data);
+    const std::uint64_t StringsStart{Head->StringOffset + std::uint64_t{Head->StringCount} * sizeof(std::uint32_t)};
+    const std::uint64_t PropsEnd{Head->PropOffset + std::uint64_t{Head->PropCount} * sizeof(PropRecord)};
+    const std::uint64_t EnemiesEnd{Head->EnemyOffset + std::uint64_t{Head->EnemyCount} * sizeof(EnemyRecord)};
+
+    if (Head->Magic != Magic || Head->Version != Version ||
+        Head->StringOffset % 4 != 0 || Head->PropOffset % 4 != 0 || Head->EnemyOffset % 4 != 0 ||
+        StringsStart > Head->PropOffset || PropsEnd > Head->EnemyOffset || EnemiesEnd > Size)
+    {
+        return false;
+    }
+
+    StringOffsets = reinterpret_cast<const std::uint32_t*>(Data + Head->StringOffset);
+    Strings = reinterpret_cast<const char*>(Data + StringsStart);
+    StringBytes = static_cast<std::size_t>(Head->PropOffset - StringsStart);
+    PropRecords = reinterpret_cast<const PropRecord*>(Data + Head->PropOffset);
+    EnemyRecords = reinterpret_cast<const EnemyRecord*>(Data + Head->EnemyOffset);
+
+    // The characters end in a terminator, so every string in range is terminated
+    if (Head->StringCount > 0 && (StringBytes == 0 || Strings[StringBytes - 1] != '\0')) {
+        return false;
+    }
+    for (std::uint32_t Index = 0; Index < Head->StringCount; ++Index) {
+        if (StringOffsets[Index] >= StringBytes) {
+            return false;
+        }
+    }
+
+    auto ValidString = [this](const std::uint16_t Index) {return Index == None || Index < Head->StringCount;};
+    auto ValidType = [](const std::uint8_t Type) {return Type <= static_cast<std::uint8_t>(PropType::PLACEHOLDER);};
+    auto ValidEnemy = [](const std::uint8_t Type) {return Type <= static_cast<std::uint8_t>(EnemyType::DEFAULT);};
+
+    for (std::uint32_t Index = 0; Index < Head->PropCount; ++Index) {
+        const PropRecord& Record{PropRecords[Index]};
+        if (Record.Layer > PropLayer::TREES || Record.Kind > PropKind::ANIMATED || !ValidType(Record.Type) || !ValidType(Record.TriggerNpc) ||
+            Record.TriggerAct > static_cast<std::uint8_t>(Progress::ACT_X) || Record.ItemType > static_cast<std::uint8_t>(ItemId::NONE) ||
+            !ValidString(Record.Sprite.Texture) || !ValidString(Record.Item))
+        {
+            return false;
+        }
+    }
+
+    for (std::uint32_t Index = 0; Index < Head->EnemyCount; ++Index) {
+        const EnemyRecord& Record{EnemyRecords[Index]};
+        if (Record.Kind > EnemyKind::NPC || Record.List > EnemyList::CROWS ||
+            !ValidEnemy(Record.Race) || !ValidEnemy(Record.Type) || !ValidEnemy(Record.BossSpawner) ||
+            !std::all_of(std::begin(Record.Sprites), std::end(Record.Sprites), [&](auto& Sprite) {return ValidString(Sprite.Texture);}))
+        {
+            return false;
+        }
+    }
+
+    // Look every image up once. One the atlas doesn't know would reach the first draw as a handle
+    // to nothing, so it fails the load here instead.
+    Resolved.assign(Head->StringCount, AtlasTexture{});
+    auto Resolve = [&](const std::uint16_t Index) {
+        if (Index == None || Resolved[Index].Entry) {
+            return true;
+        }
+        Resolved[Index] = Textures.Atlas.Find(Strings + StringOffsets[Index]);
+        if (!Resolved[Index].Entry) {
+            std::fprintf(stderr, "Level image %s is not a game texture\n", Strings + StringOffsets[Index]);
+        }
+        return Resolved[Index].Entry != nullptr;
+    };
+
+    for (std::uint32_t Index = 0; Index < Head->PropCount; ++Index) {
+        if (!Resolve(PropRecords[Index].Sprite.Texture) || !Resolve(PropRecords[Index].Item)) {
+            return false;
+        }
+    }
+    for (std::uint32_t Index = 0; Index < Head->EnemyCount; ++Index) {
+        if (!std::all_of(std::begin(EnemyRecords[Index].Sprites), std::end(EnemyRecords[Index].Sprites), [&](auto& Sprite) {return Resolve(Sprite.Texture);})) {
+            return false;
+        }
+    }
+
+    // A level without usable indexes still loads, the game just builds them itself
+    if (Head->GridCount > 0 && !ValidateIndexes()) {
+        std::fprintf(stderr, "Level indexes are corrupt, building them at load\n");
+        Grids = nullptr;
+        Mask = nullptr;
+    }
+
+    return true;
+}
+
+bool LevelFile::ValidateIndexes()
+{
+    using namespace LevelFormat;
+
+    const unsigned char* Data{File.GetData()};
+    const std::uint64_t Size{File.GetSize()};
+    auto InFile = [Size](const std::uint64_t Offset, const std::uint64_t Count, const std::uint64_t Stride) {
+        return Offset % 4 == 0 && Offset + Count * Stride <= Size;
+    };
+
+    if (Head->GridCount != GridKindCount || !InFile(Head->GridOffset, Head->GridCount, sizeof(GridRecord)) || !InFile(Head->MaskOffset, 1, sizeof(MaskRecord))) {
+        return false;
+    }
+
+    Grids = reinterpret_cast<const GridRecord*>(Data + Head->GridOffset);
+    Mask = reinterpret_cast<const MaskRecord*>(Data + Head->MaskOffset);
+
+    // Every index appears exactly once
+    unsigned Seen{};
+    for (std::uint32_t Index = 0; Index < Head->GridCount; ++Index) {
+        const GridRecord& Grid{Grids[Index]};
+        const std::uint64_t CellCount{std::uint64_t{Grid.Columns} * Grid.Rows};
+        if (static_cast<std::uint32_t>(Grid.Kind) >= GridKindCount) {
+            return false;
+        }
+
+        const unsigned Bit{1u << static_cast<unsigned>(Grid.Kind)};
+        if ((Seen & Bit) != 0 ||
+            !InFile(Grid.EntryOffset, Grid.EntryCount, sizeof(GridEntry)) ||
+            !InFile(Grid.CellOffset, CellCount + 1, sizeof(std::uint32_t)) ||
+            !InFile(Grid.LinkOffset, Grid.LinkCount, sizeof(std::uint32_t)))
+        {
+            return false;
+        }
+        Seen |= Bit;
+
+        const GridEntry* Entries{reinterpret_cast<const GridEntry*>(Data + Grid.EntryOffset)};
+        const std::uint32_t* Starts{reinterpret_cast<const std::uint32_t*>(Data + Grid.CellOffset)};
+        const std::uint32_t* Links{reinterpret_cast<const std::uint32_t*>(Data + Grid.LinkOffset)};
+
+        if (std::any_of(Entries, Entries + Grid.EntryCount, [this](auto& Entry) {return Entry.Prop >= Head->PropCount;}) ||
+            std::any_of(Links, Links + Grid.LinkCount, [&Grid](const std::uint32_t Link) {return Link >= Grid.EntryCount;}) ||
+            Starts[0] != 0 || Starts[CellCount] != Grid.LinkCount || !std::is_sorted(Starts, Starts + CellCount + 1))
+        {
+            return false;
+        }
+    }
+
+    // The word count is checked against the mask when it is imported
+    return Mask->WordOffset % 8 == 0 && InFile(Mask->WordOffset, Mask->WordCount, sizeof(std::uint64_t));
+}
+
+std::vector<std::vector<Prop>> LevelFile::LoadProps(const LevelFormat::PropLayer Layer, const GameTexture& Textures, const GameAudio& Audio) const
+{
+    using namespace LevelFormat;
+
+    std::vector<std::vector<Prop>> Groups{};
+    if (!Loaded) {
+        return Groups;
+    }
+
+    // Size every container first so the props are constructed where they will live
+    std::vector<std::size_t> Sizes{};
+    for (std::uint32_t Index = 0; Index < Head->PropCount; ++Index) {
+        if (PropRecords[Index].Layer == Layer) {
+            Sizes.resize(std::max<std::size_t>(Sizes.size(), PropRecords[Index].Group + 1));
+            ++Sizes[PropRecords[Index].Group];
+        }
+    }
+
+    Groups.resize(Sizes.size());
+    for (std::size_t Group = 0; Group < Sizes.size(); ++Group) {
+        Groups[Group].reserve(Sizes[Group]);
+    }
+
+    for (std::uint32_t Index = 0; Index < Head->PropCount; ++Index) {
+        const PropRecord& Record{PropRecords[Index]};
+        if (Record.Layer != Layer) {
+            continue;
+        }
+
+        const Vector2 Pos{Record.X, Record.Y};
+        const auto Type{static_cast<PropType>(Record.Type)};
+        const bool Moveable{(Record.Flags & MOVEABLE) != 0};
+        const bool Interactable{(Record.Flags & INTERACTABLE) != 0};
+        const bool Spawned{(Record.Flags & SPAWNED) != 0};
+        auto& Group{Groups[Record.Group]};
+
+        switch (Record.Kind) {
+            case PropKind::STATIC:
+                Group.emplace_back(GetTexture(Record.Sprite.Texture), Pos, Type, Textures, Audio, Record.Scale, 
+                                   Moveable, Interactable, (Record.Flags & INVISIBLE) != 0);
+                break;
+            case PropKind::ALTAR:
+                Group.emplace_back(GetSprite(Record.Sprite), Pos, Type, Textures, Audio, static_cast<ItemId>(Record.ItemType), Spawned, Interactable);
+                break;
+            case PropKind::ANIMATED:
+                Group.emplace_back(GetSprite(Record.Sprite), Pos, Type, Textures, Audio, GetTexture(Record.Item), Record.Scale, 
+                                   Moveable, Interactable, static_cast<Progress>(Record.TriggerAct), static_cast<PropType>(Record.TriggerNpc), 
+                                   Spawned, static_cast<ItemId>(Record.ItemType), Record.ItemScale);
+                break;
+        }
+    }
+
+    return Groups;
+}
+
+std::vector<Enemy> LevelFile::LoadEnemies(const LevelFormat::EnemyList List, Background& World, const Window& Screen, const GameTexture& Textures, 
+                                          const GameAudio& Audio, Randomizer& RandomEngine) const
+{
+    using namespace LevelFormat;
+
+    std::vector<Enemy> Result{};
+    if (!Loaded) {
+        return Result;
+    }
+
+    Result.reserve(std::count_if(EnemyRecords, EnemyRecords + Head->EnemyCount, [List](auto& Record) {return Record.List == List;}));
+
+    // In file order, which is also the order the enemies draw from RandomEngine
+    for (std::uint32_t Index = 0; Index < Head->EnemyCount; ++Index) {
+        const EnemyRecord& Record{EnemyRecords[Index]};
+        if (Record.List != List) {
+            continue;
+        }
+
+        const Vector2 Pos{Record.X, Record.Y};
+        const auto Race{static_cast<EnemyType>(Record.Race)};
+        auto Sprites = [&](const int Slot) {return GetSprite(Record.Sprites[Slot]);};
+
+        if (Record.Kind == EnemyKind::MONSTER) {
+            Result.emplace_back(Sprites(0), Sprites(1), Sprites(2), Sprites(3), Sprites(4), Sprites(5), 
+                                Race, static_cast<EnemyType>(Record.Type), Pos, Screen, World, Textures, Audio, RandomEngine, 
+                                Record.Health, Record.Scale, static_cast<EnemyType>(Record.BossSpawner));
+        }
+        else {
+            Result.emplace_back(Sprites(0), Sprites(1), Sprites(2), Sprites(3), Sprites(4), 
+                                Race, Pos, Screen, World, Textures, Audio, RandomEngine, Record.Scale);
+        }
+    }
+
+    return Result;
+}
+
+// Adopts the indexes levelc baked instead of registering every prop again. Only valid for the
+// containers this file just built and the world they were baked for; on false nothing usable was
+// imported and the caller falls back to Props::BuildGrids.
+bool LevelFile::LoadIndexes(Props& Container, std::vector<Prop>& Trees, const Vector2 WorldSize) const
+{
+    using namespace LevelFormat;
+
+    if (!Loaded || !Grids || Head->WorldWidth != WorldSize.x || Head->WorldHeight != WorldSize.y) {
+        return false;
+    }
+
+    const unsigned char* Data{File.GetData()};
+    const std::vector<Prop*> Mapped{MapProps(Container, Trees)};
+    Container.ResetGrids(WorldSize);
+
+    for (std::uint32_t Index = 0; Index < Head->GridCount; ++Index) {
+        const GridRecord& Grid{Grids[Index]};
+        const GridEntry* Entries{reinterpret_cast<const GridEntry*>(Data + Grid.EntryOffset)};
+        const std::uint32_t* Starts{reinterpret_cast<const std::uint32_t*>(Data + Grid.CellOffset)};
+        const std::uint32_t* Links{reinterpret_cast<const std::uint32_t*>(Data + Grid.LinkOffset)};
+
+        SpatialGrid<Prop>::Baked Baked{Grid.CellSize, static_cast<int>(Grid.Columns), static_cast<int>(Grid.Rows)};
+        Baked.Items.reserve(Grid.EntryCount);
+        Baked.Bounds.reserve(Grid.EntryCount);
+        for (std::uint32_t Entry = 0; Entry < Grid.EntryCount; ++Entry) {
+            if (!Mapped[Entries[Entry].Prop]) {
+                return false;
+            }
+            Baked.Items.push_back(Mapped[Entries[Entry].Prop]);
+            Baked.Bounds.push_back(Rectangle{Entries[Entry].X, Entries[Entry].Y, Entries[Entry].Width, Entries[Entry].Height});
+        }
+
+        Baked.Cells.resize(std::size_t{Grid.Columns} * Grid.Rows);
+        for (std::size_t Cell = 0; Cell < Baked.Cells.size(); ++Cell) {
+            Baked.Cells[Cell].assign(Links + Starts[Cell], Links + Starts[Cell + 1]);
+        }
+
+        bool Imported{false};
+        switch (Grid.Kind) {
+            case GridKind::UNDER_COLLISION: Imported = Container.UnderGrid.Import(std::move(Baked)); break;
+            case GridKind::OVER_COLLISION: Imported = Container.OverGrid.Import(std::move(Baked)); break;
+            case GridKind::UNDER_VISIBLE: Imported = Container.UnderVisible.Import(std::move(Baked)); break;
+            case GridKind::OVER_VISIBLE: Imported = Container.OverVisible.Import(std::move(Baked)); break;
+            case GridKind::TREE_VISIBLE: Imported = Container.TreeVisible.Import(std::move(Baked)); break;
+            case GridKind::STATIC_COLLISION: Imported = Container.StaticGrid.Import(std::move(Baked)); break;
+        }
+        if (!Imported) {
+            return false;
+        }
+    }
+
+    const auto* Words{reinterpret_cast<const std::uint64_t*>(Data + Mask->WordOffset)};
+    if (static_cast<int>(Mask->CellSize) != Container.StaticMask.GetCellSize() ||
+        !Container.StaticMask.Import({Words, Mask->WordCount}))
+    {
+        return false;
+    }
+
+    Container.TrackMovers();
+    return true;
+}
+
+// The prop each record built, in record order. Only the first group of trees is kept by the game,
+// so records of any later tree group map to nothing.
+std::vector<Prop*> LevelFile::MapProps(Props& Container, std::vector<Prop>& Trees) const
+{
+    using namespace LevelFormat;
+
+    std::vector<Prop*> Mapped(Loaded ? Head->PropCount : 0, nullptr);
+    std::vector<std::size_t> UnderUsed(Container.Under.size()), OverUsed(Container.Over.size());
+    std::size_t TreesUsed{};
+
+    auto Next = [](std::vector<std::vector<Prop>>& Groups, std::vector<std::size_t>& Used, const std::uint16_t Group) -> Prop* {
+        if (Group >= Groups.size() || Used[Group] >= Groups[Group].size()) {
+            return nullptr;
+        }
+        return &Groups[Group][Used[Group]++];
+    };
+
+    for (std::size_t Index = 0; Index < Mapped.size(); ++Index) {
+        const PropRecord& Record{PropRecords[Index]};
+        switch (Record.Layer) {
+            case PropLayer::UNDER: Mapped[Index] = Next(Container.Under, UnderUsed, Record.Group); break;
+            case PropLayer::OVER: Mapped[Index] = Next(Container.Over, OverUsed, Record.Group); break;
+            case PropLayer::TREES:
+                if (Record.Group == 0 && TreesUsed < Trees.size()) {
+                    Mapped[Index] = &Trees[TreesUsed++];
+                }
+                break;
+        }
+    }
+
+    return Mapped;
+}
+
+AtlasTexture LevelFile::GetTexture(const std::uint16_t Index) const
+{
+    return Index == LevelFormat::None ? AtlasTexture{} : Resolved[Index];
+}
+
+Sprite LevelFile::GetSprite(const LevelFormat::SpriteRecord& Record) const
+{
+    return Sprite{GetTexture(Record.Texture), Record.FramesX, Record.FramesY, Record.UpdateSpeed};
+}
@@ -1,6 +1,24 @@
 #include "game.hpp"
+#include <cstdlib>
+#include <string_view>
 
-int main() 
+int main(int argc, char* argv[])
 {
+    // --trace [seconds] records a Chrome trace from launch, so asset loading is part of it
+    for (int Arg = 1; Arg < argc; ++Arg) {
+        if (std::string_view{argv[Arg]} == "--trace") {
+            float Seconds{Arg + 1 < argc ? std::strtof(argv[Arg + 1], nullptr) : 0.f};
+            Profiler::StartCapture(Seconds > 0.f ? Seconds : Profiler::DefaultCaptureSeconds, Game::TracePath);
+        }
+    }
+
+    // --headless [frames] [input script] runs the simulation without a window, for profiling on build servers
+    if (argc > 1 && std::string_view{argv[1]} == "--headless") {
+        int Frames{argc > 2 ? std::atoi(argv[2]) : 1000};
+        std::string ScriptPath{argc > 3 && std::string_view{argv[3]} != "--trace" ? argv[3] : ""};
+        Game::RunHeadless(Frames, ScriptPath);
+        return 0;
+    }
+
     Game::Run();
-}
\ No newline at end of file
+}
@@ -0,0 +1,80 @@
+#include "mappedfile.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& Path)
+{
+    File = CreateFileA(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (File == INVALID_HANDLE_VALUE) {
+        File = nullptr;
+        return;
+    }
+
+    LARGE_INTEGER FileSize{};
+    if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart == 0) {
+        return;
+    }
+
+    Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!Mapping) {
+        return;
+    }
+
+    Data = static_cast<const unsigned char*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+    Size = Data ? static_cast<std::size_t>(FileSize.QuadPart) : 0;
+}
+
+MappedFile::~MappedFile()
+{
+    if (Data) {
+        UnmapViewOfFile(Data);
+    }
+    if (Mapping) {
+        CloseHandle(Mapping);
+    }
+    if (File) {
+        CloseHandle(File);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& Path)
+{
+    int File{open(Path.c_str(), O_RDONLY)};
+    if (File < 0) {
+        return;
+    }
+
+    struct stat Info{};
+    if (fstat(File, &Info) == 0 && Info.st_size > 0) {
+        void* View{mmap(nullptr, static_cast<std::size_t>(Info.st_size), PROT_READ, MAP_PRIVATE, File, 0)};
+        if (View != MAP_FAILED) {
+            Data = static_cast<const unsigned char*>(View);
+            Size = static_cast<std::size_t>(Info.st_size);
+        }
+    }
+
+    // The mapping keeps the file alive on its own
+    close(File);
+}
+
+MappedFile::~MappedFile()
+{
+    if (Data) {
+        munmap(const_cast<unsigned char*>(Data), Size);
+    }
+}
+
+#endif
@@ -0,0 +1,287 @@
+#include "platform.hpp"
+#include "profiler.hpp"
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    // One line of an input script: Input is held from frame Start through frame End
+    struct ScriptedInput
+    {
+        int Start{};
+        int End{};
+        int Input{};
+        bool Mouse{false};
+    };
+
+    bool Headless{false};
+    int HeadlessWidth{};
+    int HeadlessHeight{};
+    float HeadlessFrameTime{};
+    int Frame{};
+    std::vector<ScriptedInput> Script{};
+
+    bool Stepping{false};
+    bool FirstStep{true};
+    float StepTime{};
+    std::vector<int> PressedKeys{};
+    std::array<bool, 3> PressedButtons{};
+
+    std::mutex WaveLock{};
+    std::unordered_map<std::string, Wave> Waves{};
+
+    const std::unordered_map<std::string, int> KeyNames
+    {
+        {"A", KEY_A}, {"B", KEY_B}, {"C", KEY_C}, {"D", KEY_D}, {"E", KEY_E}, {"F", KEY_F}, {"G", KEY_G},
+        {"H", KEY_H}, {"I", KEY_I}, {"J", KEY_J}, {"K", KEY_K}, {"L", KEY_L}, {"M", KEY_M}, {"N", KEY_N},
+        {"O", KEY_O}, {"P", KEY_P}, {"Q", KEY_Q}, {"R", KEY_R}, {"S", KEY_S}, {"T", KEY_T}, {"U", KEY_U},
+        {"V", KEY_V}, {"W", KEY_W}, {"X", KEY_X}, {"Y", KEY_Y}, {"Z", KEY_Z},
+        {"0", KEY_ZERO}, {"1", KEY_ONE}, {"2", KEY_TWO}, {"3", KEY_THREE}, {"4", KEY_FOUR},
+        {"5", KEY_FIVE}, {"6", KEY_SIX}, {"7", KEY_SEVEN}, {"8", KEY_EIGHT}, {"9", KEY_NINE},
+        {"F1", KEY_F1}, {"F2", KEY_F2}, {"F3", KEY_F3}, {"F4", KEY_F4}, {"F5", KEY_F5}, {"F6", KEY_F6},
+        {"SPACE", KEY_SPACE}, {"ENTER", KEY_ENTER}, {"ESCAPE", KEY_ESCAPE}, {"GRAVE", KEY_GRAVE},
+        {"PERIOD", KEY_PERIOD}, {"EQUAL", KEY_EQUAL}, {"MINUS", KEY_MINUS}, {"LEFT_SHIFT", KEY_LEFT_SHIFT},
+        {"UP", KEY_UP}, {"DOWN", KEY_DOWN}, {"LEFT", KEY_LEFT}, {"RIGHT", KEY_RIGHT}
+    };
+
+    const std::unordered_map<std::string, int> MouseNames
+    {
+        {"MOUSE_LEFT", MOUSE_BUTTON_LEFT}, {"MOUSE_RIGHT", MOUSE_BUTTON_RIGHT}, {"MOUSE_MIDDLE", MOUSE_BUTTON_MIDDLE}
+    };
+
+    bool IsScriptedDown(const int Input, const bool Mouse, const int AtFrame)
+    {
+        for (auto& Entry:Script) {
+            if (Entry.Input == Input && Entry.Mouse == Mouse && AtFrame >= Entry.Start && AtFrame <= Entry.End) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+namespace Platform
+{
+    void SetHeadless(const int ScreenWidth, const int ScreenHeight, const float FrameTime)
+    {
+        Headless = true;
+        HeadlessWidth = ScreenWidth;
+        HeadlessHeight = ScreenHeight;
+        HeadlessFrameTime = FrameTime;
+        Frame = 0;
+    }
+
+    bool IsHeadless()
+    {
+        return Headless;
+    }
+
+    // Each non-empty line reads "<start frame> <end frame> <input>", e.g. "0 240 D" holds D for
+    // the first 241 frames and "300 300 SPACE" taps space once. Lines starting with # are comments.
+    bool LoadInputScript(const std::string& Path)
+    {
+        std::ifstream File{Path};
+        if (!File) {
+            TraceLog(LOG_ERROR, "Input script %s could not be opened", Path.c_str());
+            return false;
+        }
+
+        Script.clear();
+        std::string Line{};
+        int LineNumber{};
+
+        while (std::getline(File, Line)) {
+            ++LineNumber;
+            if (Line.empty() || Line.front() == '#') {
+                continue;
+            }
+
+            std::istringstream Fields{Line};
+            ScriptedInput Entry{};
+            std::string Name{};
+
+            if (!(Fields >> Entry.Start >> Entry.End >> Name)) {
+                TraceLog(LOG_ERROR, "Input script %s:%i is not '<start> <end> <input>'", Path.c_str(), LineNumber);
+                return false;
+            }
+
+            if (KeyNames.contains(Name)) {
+                Entry.Input = KeyNames.at(Name);
+            }
+            else if (MouseNames.contains(Name)) {
+                Entry.Input = MouseNames.at(Name);
+                Entry.Mouse = true;
+            }
+            else {
+                TraceLog(LOG_ERROR, "Input script %s:%i has unknown input %s", Path.c_str(), LineNumber, Name.c_str());
+                return false;
+            }
+            Script.push_back(Entry);
+        }
+        return true;
+    }
+
+    void NextFrame()
+    {
+        ++Frame;
+    }
+
+    int GetFrame()
+    {
+        return Frame;
+    }
+
+    void BeginFrame()
+    {
+        if (Headless) {
+            return;
+        }
+
+        // Presses only last one rendered frame in raylib, so hold on to them until a step consumes them
+        for (int Key = ::GetKeyPressed(); Key != 0; Key = ::GetKeyPressed()) {
+            if (std::find(PressedKeys.begin(), PressedKeys.end(), Key) == PressedKeys.end()) {
+                PressedKeys.push_back(Key);
+            }
+        }
+
+        for (int Button = 0; Button < static_cast<int>(PressedButtons.size()); ++Button) {
+            PressedButtons[Button] = PressedButtons[Button] || ::IsMouseButtonPressed(Button);
+        }
+        FirstStep = true;
+    }
+
+    void BeginStep(const float Step)
+    {
+        Stepping = true;
+        StepTime = Step;
+    }
+
+    void EndStep()
+    {
+        Stepping = false;
+        FirstStep = false;
+        PressedKeys.clear();
+        PressedButtons.fill(false);
+    }
+
+    bool IsKeyDown(const int Key)
+    {
+        return Headless ? IsScriptedDown(Key, false, Frame) : ::IsKeyDown(Key);
+    }
+
+    bool IsKeyPressed(const int Key)
+    {
+        if (Headless) {
+            return IsScriptedDown(Key, false, Frame) && !IsScriptedDown(Key, false, Frame - 1);
+        }
+        if (Stepping) {
+            return std::find(PressedKeys.begin(), PressedKeys.end(), Key) != PressedKeys.end();
+        }
+        return ::IsKeyPressed(Key);
+    }
+
+    bool IsKeyReleased(const int Key)
+    {
+        if (Headless) {
+            return !IsScriptedDown(Key, false, Frame) && IsScriptedDown(Key, false, Frame - 1);
+        }
+        if (Stepping) {
+            return FirstStep && ::IsKeyReleased(Key);
+        }
+        return ::IsKeyReleased(Key);
+    }
+
+    bool IsMouseButtonDown(const int Button)
+    {
+        return Headless ? IsScriptedDown(Button, true, Frame) : ::IsMouseButtonDown(Button);
+    }
+
+    bool IsMouseButtonPressed(const int Button)
+    {
+        if (Headless) {
+            return IsScriptedDown(Button, true, Frame) && !IsScriptedDown(Button, true, Frame - 1);
+        }
+        if (Stepping && Button >= 0 && Button < static_cast<int>(PressedButtons.size())) {
+            return PressedButtons[Button];
+        }
+        return ::IsMouseButtonPressed(Button);
+    }
+
+    int GetScreenWidth()
+    {
+        return Headless ? HeadlessWidth : ::GetScreenWidth();
+    }
+
+    int GetScreenHeight()
+    {
+        return Headless ? HeadlessHeight : ::GetScreenHeight();
+    }
+
+    float GetFrameTime()
+    {
+        if (Headless) {
+            return HeadlessFrameTime;
+        }
+        return Stepping ? StepTime : ::GetFrameTime();
+    }
+
+    void PrefetchSounds(AssetLoader& Loader, const std::string& Directory)
+    {
+        if (Headless) {
+            return;
+        }
+
+        std::error_code Error{};
+        for (auto& File:std::filesystem::directory_iterator{Directory, Error}) {
+            if (File.path().extension() != ".wav") {
+                continue;
+            }
+            Loader.Submit([Path = File.path().generic_string()] {
+                Wave Decoded{LoadWave(Path.c_str())};
+                std::lock_guard<std::mutex> Guard{WaveLock};
+                Waves[Path] = Decoded;
+            });
+        }
+    }
+
+    // Frees waves nothing asked for
+    void ClearPrefetchedSounds()
+    {
+        std::lock_guard<std::mutex> Guard{WaveLock};
+        for (auto& [Path, Decoded]:Waves) {
+            UnloadWave(Decoded);
+        }
+        Waves.clear();
+    }
+
+    Sound LoadSound(const char* Path)
+    {
+        Profiler::Scope Timer{Profiler::Zone::AUDIO_LOAD};
+        if (Headless) {
+            return Sound{};
+        }
+
+        std::lock_guard<std::mutex> Guard{WaveLock};
+        auto Prefetched{Waves.find(Path)};
+        if (Prefetched == Waves.end()) {
+            return ::LoadSound(Path);
+        }
+
+        Sound Loaded{LoadSoundFromWave(Prefetched->second)};
+        UnloadWave(Prefetched->second);
+        Waves.erase(Prefetched);
+        return Loaded;
+    }
+
+    Music LoadMusicStream(const char* Path)
+    {
+        Profiler::Scope Timer{Profiler::Zone::AUDIO_LOAD};
+        return Headless ? Music{} : ::LoadMusicStream(Path);
+    }
+}
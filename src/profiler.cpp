@@ -0,0 +1,226 @@
+#include "profiler.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    constexpr int ZoneCount{static_cast<int>(Profiler::Zone::COUNT)};
+
+    struct ZoneInfo
+    {
+        const char* Name{};
+        const char* Category{};         // Groups zones in the trace viewer
+        int Depth{};                    // Nesting under the frame, for indenting the overlay
+        bool Traced{true};              // Per-entity zones fire thousands of times a frame; captures keep their loops instead
+    };
+
+    constexpr std::array<ZoneInfo, ZoneCount> Zones
+    {
+        ZoneInfo{"Game::Tick", "frame", 0},
+        ZoneInfo{"ForestUpdate", "update", 1},
+        ZoneInfo{"DungeonUpdate", "update", 1},
+        ZoneInfo{"UpdateMusicStream", "audio", 2},
+        ZoneInfo{"Character::Tick", "update", 2},
+        ZoneInfo{"Enemies", "update", 2},
+        ZoneInfo{"Enemy::Think", "update", 3},
+        ZoneInfo{"Enemy::Apply", "update", 3},
+        ZoneInfo{"Crows", "update", 2},
+        ZoneInfo{"Props", "update", 2},
+        ZoneInfo{"Prop::Tick", "update", 3, false},
+        ZoneInfo{"Trees", "update", 2},
+        ZoneInfo{"ForestDraw", "draw", 1},
+        ZoneInfo{"DungeonDraw", "draw", 1},
+        ZoneInfo{"RenderQueue::Flush", "draw", 2},
+        ZoneInfo{"Dialogue text", "draw", 2},
+        ZoneInfo{"LoadTexture", "asset", 0},
+        ZoneInfo{"LoadAudio", "asset", 0}
+    };
+
+    struct Event
+    {
+        Profiler::Zone Zone{};
+        Profiler::Clock::time_point Start{};
+        Profiler::Clock::time_point End{};
+    };
+
+    // Overlay
+    bool Overlay{false};
+    std::array<Profiler::Clock::duration, ZoneCount> Totals{};
+    std::array<std::array<float, Profiler::History>, ZoneCount> Samples{};   // Milliseconds per frame
+    int Cursor{};
+    int Frames{};
+
+    // Capture
+    bool Capturing{false};
+    Profiler::Clock::time_point CaptureStart{};
+    Profiler::Clock::duration CaptureLength{};
+    std::string CapturePath{};
+    std::vector<Event> Events{};
+
+    int ToIndex(const Profiler::Zone Zone)
+    {
+        return static_cast<int>(Zone);
+    }
+
+    void UpdateEnabled()
+    {
+        Profiler::Enabled = Overlay || Capturing;
+    }
+
+    double ToMicroseconds(const Profiler::Clock::duration Duration)
+    {
+        return std::chrono::duration<double, std::micro>{Duration}.count();
+    }
+
+    // Complete ("X") events on one thread; timestamps are microseconds since the capture started
+    bool WriteTrace(const std::string& Path)
+    {
+        std::FILE* File{std::fopen(Path.c_str(), "w")};
+        if (!File) {
+            return false;
+        }
+
+        std::fprintf(File, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        std::fprintf(File, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Main\"}}");
+
+        for (auto& Entry:Events) {
+            auto& Info{Zones[ToIndex(Entry.Zone)]};
+            std::fprintf(File, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}",
+                         Info.Name, Info.Category, ToMicroseconds(Entry.Start - CaptureStart), ToMicroseconds(Entry.End - Entry.Start));
+        }
+
+        std::fprintf(File, "\n]}\n");
+        return std::fclose(File) == 0;
+    }
+}
+
+namespace Profiler
+{
+    void SetEnabled(const bool Input)
+    {
+        // Start every session from an empty history so old frames don't skew the numbers
+        if (Input && !Overlay) {
+            Totals.fill(Clock::duration::zero());
+            Cursor = 0;
+            Frames = 0;
+        }
+        Overlay = Input;
+        UpdateEnabled();
+    }
+
+    void Record(const Zone Zone, const Clock::time_point Start, const Clock::time_point End)
+    {
+        if (Overlay) {
+            Totals[ToIndex(Zone)] += End - Start;
+        }
+        if (Capturing && Zones[ToIndex(Zone)].Traced) {
+            Events.push_back(Event{Zone, Start, End});
+        }
+    }
+
+    void EndFrame()
+    {
+        if (Capturing && Clock::now() - CaptureStart >= CaptureLength) {
+            StopCapture();
+        }
+
+        if (!Overlay) {
+            return;
+        }
+
+        for (int Index = 0; Index < ZoneCount; ++Index) {
+            Samples[Index][Cursor] = std::chrono::duration<float, std::milli>{Totals[Index]}.count();
+            Totals[Index] = Clock::duration::zero();
+        }
+
+        Cursor = (Cursor + 1) % History;
+        Frames = std::min(Frames + 1, History);
+    }
+
+    int GetFrames()
+    {
+        return Frames;
+    }
+
+    Stats GetStats(const Zone Zone)
+    {
+        if (Frames == 0) {
+            return Stats{};
+        }
+
+        std::array<float, History> Sorted{};
+        auto& Source{Samples[ToIndex(Zone)]};
+        std::copy(Source.begin(), Source.begin() + Frames, Sorted.begin());
+
+        Stats Result{};
+        float Sum{};
+        Result.Min = Sorted[0];
+
+        for (int Index = 0; Index < Frames; ++Index) {
+            Result.Min = std::min(Result.Min, Sorted[Index]);
+            Sum += Sorted[Index];
+        }
+        Result.Average = Sum / static_cast<float>(Frames);
+
+        // Only the 99th percentile needs to land in place, not the whole order
+        int Rank{std::max(0, static_cast<int>(std::ceil(0.99f * static_cast<float>(Frames))) - 1)};
+        std::nth_element(Sorted.begin(), Sorted.begin() + Rank, Sorted.begin() + Frames);
+        Result.P99 = Sorted[Rank];
+
+        return Result;
+    }
+
+    const char* GetName(const Zone Zone)
+    {
+        return Zones[ToIndex(Zone)].Name;
+    }
+
+    int GetDepth(const Zone Zone)
+    {
+        return Zones[ToIndex(Zone)].Depth;
+    }
+
+    void StartCapture(const float Seconds, const std::string& Path)
+    {
+        if (Capturing) {
+            return;
+        }
+
+        Capturing = true;
+        CaptureStart = Clock::now();
+        CaptureLength = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>{Seconds});
+        CapturePath = Path;
+        Events.clear();
+        Events.reserve(1 << 16);
+        UpdateEnabled();
+    }
+
+    // Ends the capture early or on time and writes what was recorded
+    void StopCapture()
+    {
+        if (!Capturing) {
+            return;
+        }
+
+        Capturing = false;
+        UpdateEnabled();
+
+        if (WriteTrace(CapturePath)) {
+            std::printf("Trace of %zu events written to %s\n", Events.size(), CapturePath.c_str());
+        }
+        else {
+            std::fprintf(stderr, "Trace could not be written to %s\n", CapturePath.c_str());
+        }
+
+        Events.clear();
+        Events.shrink_to_fit();
+    }
+
+    bool IsCapturing()
+    {
+        return Capturing;
+    }
+}
@@ -1,7 +1,7 @@
 #include "prop.hpp"
 
 // Constructor for inanimate props
-Prop::Prop(const Texture2D& Texture, 
+Prop::Prop(const AtlasTexture& Texture, 
            const Vector2 Pos, 
            const PropType Type, 
            const GameTexture& GameTextures, 
@@ -37,6 +37,8 @@ Prop::Prop(const Texture2D& Texture,
     {
         Collidable = true;
     }
+
+    UpdateShapes();
 }
 
 // Constructor for animated altar pieces
@@ -45,12 +47,13 @@ Prop::Prop(const Sprite& Object,
            const PropType Type, 
            const GameTexture& GameTextures, 
            const GameAudio& Audio,
-           const std::string& ItemName, 
+           const ItemId ItemType, 
            const bool Spawned, 
            const bool Interactable)
-    : Object{Object}, Type{Type}, GameTextures{GameTextures}, Audio{Audio}, WorldPos{Pos}, Interactable{Interactable}, Spawned{Spawned}, ItemName{ItemName} 
+    : Object{Object}, Type{Type}, GameTextures{GameTextures}, Audio{Audio}, WorldPos{Pos}, Interactable{Interactable}, Spawned{Spawned}, ItemType{ItemType} 
 {
     Collidable = true;
+    UpdateShapes();
 }
 
 // Constructor for animated props
@@ -59,17 +62,17 @@ Prop::Prop(const Sprite& Object,
            const PropType Type, 
            const GameTexture& GameTextures, 
            const GameAudio& Audio,
-           const Texture2D& Item, 
+           const AtlasTexture& Item, 
            const float Scale, 
            const bool Moveable, 
            const bool Interactable,
            const Progress TriggerAct, 
            const PropType TriggerNPC,  
            const bool Spawn,
-           const std::string& ItemName, 
+           const ItemId ItemType, 
            const float ItemScale)
     : Object{Object}, Type{Type}, GameTextures{GameTextures}, Audio{Audio}, WorldPos{Pos}, Scale{Scale}, Interactable{Interactable}, Moveable{Moveable}, 
-      Spawned{Spawn}, TriggerAct{TriggerAct}, TriggerNPC{TriggerNPC}, Item{Item}, ItemName{ItemName}, ItemScale{ItemScale} 
+      Spawned{Spawn}, TriggerAct{TriggerAct}, TriggerNPC{TriggerNPC}, Item{Item}, ItemType{ItemType}, ItemScale{ItemScale} 
 {
     if (Type == PropType::GRASS ||
         Type == PropType::TREASURE ||
@@ -106,10 +109,14 @@ Prop::Prop(const Sprite& Object,
             ItemPos.x = 0.f;
         }
     }
+
+    UpdateShapes();
 }
 
 void Prop::Tick(const float DeltaTime)
 {
+    Profiler::Scope Timer{Profiler::Zone::PROP_TICK};
+
     if (Visible) {
         if ((Type == PropType::NPC_DIANA || 
              Type == PropType::NPC_JADE || 
@@ -133,7 +140,7 @@ void Prop::Tick(const float DeltaTime)
                     TreasureTick(DeltaTime);
                     break;
                 case PropType::BIGTREASURE:
-                    if (FinalChestKey) {
+                    if (Quest.FinalChestKey) {
                         TreasureTick(DeltaTime);
                     }
                     break;
@@ -160,47 +167,52 @@ void Prop::Tick(const float DeltaTime)
             OpenChest(DeltaTime);
         }
     }
-    UpdateNpcInactive();
-    UpdateNewInfo();
-    CheckFinalChest();
+
+    // Grass only rustles while something is standing in it. The character and enemies
+    // re-mark it every frame they overlap it, so clear it here rather than in their scans
+    if (Type == PropType::GRASS) {
+        Active = false;
+    }
+
+    UpdateQuest();
 }
 
-void Prop::Draw(const Vector2 CharacterWorldPos)
+void Prop::Draw(RenderQueue& Queue, const RenderLayer Layer, const Vector2 CharacterWorldPos)
 {
     Vector2 ScreenPos {Vector2Subtract(WorldPos, CharacterWorldPos)};
 
     CheckVisibility(CharacterWorldPos);
 
-    if (Visible && !Invisible) {
+    if (Visible && !Invisible && !Baked) {
         if (Type == PropType::BIGTREASURE) {
-            if (FinalChestSpawned) {
-                DrawTexturePro(Object.Texture, Object.GetSourceRec(), Object.GetPosRec(ScreenPos, Scale), Vector2{}, 0.f, WHITE);
+            if (Quest.FinalChestSpawned) {
+                Queue.Submit(Layer, Object.Texture, Object.GetSourceRec(), Object.GetPosRec(ScreenPos, Scale), WHITE);
             }
         }
         else {
-            DrawTexturePro(Object.Texture, Object.GetSourceRec(), Object.GetPosRec(ScreenPos, Scale), Vector2{}, 0.f, WHITE);
+            Queue.Submit(Layer, Object.Texture, Object.GetSourceRec(), Object.GetPosRec(ScreenPos, Scale), WHITE);
         }
 
         // Draw the animated altar piece
-        if (Type == PropType::ANIMATEDALTAR) {
-            for (auto& Piece:AltarPieces) {
-                if (std::get<2>(Piece) == true && std::get<0>(Piece) == ItemName) {
-                    DrawTextureEx(Object.Texture, WorldPos, 0.f, Scale, WHITE);
-                }
-            }
+        if (Type == PropType::ANIMATEDALTAR && IsAltarPiece(ItemType) && PiecesVisible.test(GetItemIndex(ItemType))) {
+            Queue.Submit(Layer, Object.Texture, WorldPos, Scale, WHITE);
         }
 
         if  (NewInfo && (Type == PropType::NPC_DIANA || Type == PropType::NPC_JADE || Type == PropType::NPC_SON || Type == PropType::NPC_RUMBY)) {
-            DrawTextureEx(GameTextures.Interact, Vector2{Object.GetPosRec(ScreenPos, Scale).x + static_cast<float>(Object.Texture.width)/1.8f, Object.GetPosRec(ScreenPos, Scale).y - static_cast<float>(Object.Texture.height)/2.f}, 0.f, 2.f, WHITE);
+            Queue.Submit(Layer, GameTextures.Interact, Vector2{Object.GetPosRec(ScreenPos, Scale).x + static_cast<float>(Object.Texture.width)/1.8f, Object.GetPosRec(ScreenPos, Scale).y - static_cast<float>(Object.Texture.height)/2.f}, 2.f, WHITE);
         }
     }
     
     // Draw Treasure Box Item
     if (Opening) {
-        DrawTextureEx(Item, Vector2Add(ScreenPos, ItemPos), 0.f, ItemScale, WHITE);
+        Queue.Submit(Layer, Item, Vector2Add(ScreenPos, ItemPos), ItemScale, WHITE);
         ItemPos = Vector2Add(ItemPos, Vector2{0.f,-0.1f});
     }
+}
 
+// Speech boxes go over every sprite of the frame, so they are drawn once the render queue is flushed
+void Prop::DrawDialogue()
+{
     // Treasure Speech Box
     if (ReceiveItem) {
         DrawTextureEx(GameTextures.SpeechBox, Vector2{472.f,574.f}, 0.f, 8.f, WHITE);
@@ -250,37 +262,44 @@ void Prop::Draw(const Vector2 CharacterWorldPos)
     }
 }
 
+// Draws the current frame relative to Origin, the world position of the top-left corner of the target
+void Prop::DrawSprite(const Vector2 Origin)
+{
+    DrawTexturePro(Object.Texture, Object.GetSourceRec(), Object.GetPosRec(Vector2Subtract(WorldPos, Origin), Scale), Vector2{}, 0.f, WHITE);
+}
+
 void Prop::NpcTick(const float DeltaTime)
 {
     Object.Tick(DeltaTime);
 
-    // Update any progression and triggers for NPCs
-    for (auto& [ParentNpc,Pair]:QuestlineProgress) {
-        if (Type == Pair.second) {
-            Act = Pair.first;
-            Pair.first = Progress::ACT_O;
-            Pair.second = PropType::NPC_O;
+    // Pick up any act another NPC or a chest unlocked for this one. The triggers only move when
+    // a quest step completes, so there is nothing to look for until they differ from last time.
+    if (Quest.Changed(SeenTriggers) & ACT_TRIGGERS) {
+        for (auto& Trigger:Quest.Triggers) {
+            if (Type == Trigger.Npc) {
+                Act = Trigger.Act;
+                Trigger = ActTrigger{};
+            }
         }
+        SeenTriggers = Quest;
     }
 }
 
 void Prop::AltarTick(const float DeltaTime)
 {
-    for (auto& Piece:AltarPieces) {
-        if (ItemName == std::get<0>(Piece) && std::get<2>(Piece) == true) {
-            Object.Tick(DeltaTime);
-        }
+    if (IsAltarPiece(ItemType) && PiecesVisible.test(GetItemIndex(ItemType))) {
+        Object.Tick(DeltaTime);
     }
 }
 
 void Prop::OpenChest(const float DeltaTime)
 {
     ReceiveItem = true;
-    if (ItemName == "Cryptex") {
-        CryptexReceived = true;
+    if (ItemType == ItemId::CRYPTEX) {
+        Quest.CryptexReceived = true;
     }
     else {
-        ++PiecesReceived;
+        ++Quest.PiecesReceived;
     }
     // controls 'press enter' delay to close dialogue
     RunningTime += DeltaTime;
@@ -306,21 +325,18 @@ void Prop::TreasureTick(const float DeltaTime)
         RunningTime = 0.f; 
     }
 
-    for (auto& Piece:AltarPieces) {
-        if (std::get<0>(Piece) == ItemName) {
-            std::get<1>(Piece) = true;
-        }
+    if (IsAltarPiece(ItemType)) {
+        PiecesUnlocked.set(GetItemIndex(ItemType));
     }
 
     if (Type == PropType::BIGTREASURE) {
-        BraceletReceived = true;
-        FinalAct = true;
+        Quest.BraceletReceived = true;
+        Quest.FinalAct = true;
         MuteNewInfo = false;
     }
 
     if (TriggerAct != Progress::ACT_O) {
-        QuestlineProgress.at(PropType::TREASURE).first = TriggerAct;
-        QuestlineProgress.at(PropType::TREASURE).second = TriggerNPC;
+        Quest.Triggers[TREASURE_TRIGGER] = {TriggerAct, TriggerNPC};
     }
 }
 
@@ -338,31 +354,28 @@ void Prop::InsertAltarPiece()
 {
     AltarAudio();
 
-    if (PiecesAdded == 0) {
+    if (Quest.PiecesAdded == 0) {
         InsertPiece = true;
     }
 
-    if (PiecesAdded >= 6) {
-        FinalChestSpawned = true;
+    if (Quest.PiecesAdded >= 6) {
+        Quest.FinalChestSpawned = true;
     }
 
-    if (FirstPieceInserted) {
-        for (auto& Piece:AltarPieces) {
-            if (std::get<1>(Piece) == true) {
-                std::get<2>(Piece) = true;
-                InsertPiece = true;
-            }
-            if (std::get<2>(Piece) == true && std::get<3>(Piece) == false) {
-                std::get<3>(Piece) = true;
-                PiecesAdded++;
-            }
+    if (Quest.FirstPieceInserted) {
+        if (PiecesUnlocked.any()) {
+            PiecesVisible |= PiecesUnlocked;
+            InsertPiece = true;
         }
 
+        Quest.PiecesAdded += static_cast<int>((PiecesVisible & ~PiecesInserted).count());
+        PiecesInserted |= PiecesVisible;
+
         Opened = true;
     }
     else {
-        if (IsKeyPressed(KEY_ENTER)) {
-            FirstPieceInserted = true;
+        if (Platform::IsKeyPressed(KEY_ENTER)) {
+            Quest.FirstPieceInserted = true;
         }
     }
 }
@@ -374,6 +387,61 @@ void Prop::TalkToNpc()
     UpdateNpcActive();
 }
 
+// Quest bookkeeping of NPCs and the final chest. A pass that changes nothing would change nothing
+// again until its inputs do, so instead of polling every frame it reruns only when a quest
+// variable the prop subscribes to or its own state has moved, and keeps rerunning until it settles.
+void Prop::UpdateQuest()
+{
+    if (QuestSubscriptions == 0) {
+        return;
+    }
+
+    QuestInputs Current{GetQuestInputs()};
+    if (QuestSettled && Current == SeenInputs && (Quest.Changed(SeenQuest) & QuestSubscriptions) == 0) {
+        return;
+    }
+
+    UpdateNpcInactive();
+    UpdateNewInfo();
+    CheckFinalChest();
+
+    SeenQuest = Quest;
+    SeenInputs = GetQuestInputs();
+    QuestSettled = SeenInputs == Current;
+}
+
+// The quest variables each kind of prop reads in UpdateNpcInactive(), UpdateNewInfo() and CheckFinalChest()
+std::uint16_t Prop::GetQuestSubscriptions(const PropType Type)
+{
+    switch (Type)
+    {
+        case PropType::NPC_DIANA:
+            return BRACELET_RECEIVED | PIECES_ADDED | PIECES_RECEIVED | CRYPTEX_RECEIVED | FINAL_CHEST_KEY;
+        case PropType::NPC_JADE:
+            return BRACELET_RECEIVED | SON_SAVED | PIECES_RECEIVED;
+        case PropType::NPC_SON:
+            return BRACELET_RECEIVED | PIECES_ADDED | PIECES_RECEIVED;
+        case PropType::NPC_RUMBY:
+            return BRACELET_RECEIVED;
+        case PropType::BIGTREASURE:
+            return FINAL_CHEST_SPAWNED;
+        default:
+            return 0;
+    }
+}
+
+Prop::QuestInputs Prop::GetQuestInputs() const
+{
+    return QuestInputs{Act, WorldPos, Visible, Spawned, NewInfo, MuteNewInfo, ReadyToProgress};
+}
+
+bool Prop::QuestInputs::operator==(const QuestInputs& Other) const
+{
+    return Act == Other.Act && WorldPos.x == Other.WorldPos.x && WorldPos.y == Other.WorldPos.y &&
+           Visible == Other.Visible && Spawned == Other.Spawned && NewInfo == Other.NewInfo &&
+           MuteNewInfo == Other.MuteNewInfo && ReadyToProgress == Other.ReadyToProgress;
+}
+
 void Prop::UpdateNpcInactive()
 {
     if (!Visible) {
@@ -381,22 +449,22 @@ void Prop::UpdateNpcInactive()
         {
             case PropType::NPC_DIANA:
             {
-                if (BraceletReceived) {
+                if (Quest.BraceletReceived) {
                     Act = Progress::ACT_VIII;
                     WorldPos.x = 500.f;
                     WorldPos.y = 3653.f;
                 }
 
-                if (PiecesAdded >= 1 && PiecesAdded <= 5 && ReadyToProgress && !CryptexReceived) {
+                if (Quest.PiecesAdded >= 1 && Quest.PiecesAdded <= 5 && ReadyToProgress && !Quest.CryptexReceived) {
                     WorldPos.x = 3163.f;
                     WorldPos.y = 2853.f;
                     ReadyToProgress = false;
                 }
-                else if (PiecesAdded >= 1 && PiecesAdded <= 5 && !ReadyToProgress) {
+                else if (Quest.PiecesAdded >= 1 && Quest.PiecesAdded <= 5 && !ReadyToProgress) {
                     Act = Progress::ACT_IV;
                 }
 
-                if (PiecesAdded == 6 && (Act == Progress::ACT_IV || Act == Progress::ACT_V)) {
+                if (Quest.PiecesAdded == 6 && (Act == Progress::ACT_IV || Act == Progress::ACT_V)) {
                     WorldPos.x = 645.f;
                     WorldPos.y = 1777.f;
                     Act = Progress::ACT_VI;
@@ -405,34 +473,34 @@ void Prop::UpdateNpcInactive()
             }
             case PropType::NPC_JADE:
             {   
-                if (BraceletReceived) {
+                if (Quest.BraceletReceived) {
                     Act = Progress::ACT_VIII;
                     WorldPos.x = 1060.f;
                     WorldPos.y = 3409.f;
                     MuteNewInfo = false;
                 }
-                else if (Act == Progress::ACT_I && SonSaved) {
+                else if (Act == Progress::ACT_I && Quest.SonSaved) {
                     WorldPos.x = 1549.f;
                     WorldPos.y = 2945.f;
                     ReadyToProgress = false;
                 }
-                else if (PiecesReceived >= 1) {
+                else if (Quest.PiecesReceived >= 1) {
                     Act = Progress::ACT_IV;
                 }
                 break;
             }
             case PropType::NPC_SON:
             {
-                if (BraceletReceived) {
+                if (Quest.BraceletReceived) {
                     Act = Progress::ACT_VIII;
                     WorldPos.x = 1160.f;
                     WorldPos.y = 3409.f;
                 }
-                else if (PiecesAdded >= 1 && PiecesAdded <= 4) {
+                else if (Quest.PiecesAdded >= 1 && Quest.PiecesAdded <= 4) {
                     Act = Progress::ACT_V;
                     ReadyToProgress = false;
                 }
-                else if (PiecesAdded > 4) {
+                else if (Quest.PiecesAdded > 4) {
                     Act = Progress::ACT_VI;
                 }
                 else if (Act == Progress::ACT_II && ReadyToProgress) {
@@ -445,7 +513,7 @@ void Prop::UpdateNpcInactive()
             }
             case PropType::NPC_RUMBY:
             {
-                if (BraceletReceived) {
+                if (Quest.BraceletReceived) {
                     Act = Progress::ACT_VIII;
                     WorldPos.x = 769.f;
                     WorldPos.y = 3665.f;
@@ -455,6 +523,7 @@ void Prop::UpdateNpcInactive()
             default:
                 break;
         }
+        UpdateShapes();
     }
 }
 
@@ -468,19 +537,17 @@ void Prop::UpdateNpcActive()
             {
                 case PropType::NPC_DIANA:
                 {
-                    if (PiecesReceived >= 1) {
+                    if (Quest.PiecesReceived >= 1) {
                         Act = Progress::ACT_III;
                     }
                     else {
-                        QuestlineProgress.at(PropType::NPC_DIANA).first = Progress::ACT_II; 
-                        QuestlineProgress.at(PropType::NPC_DIANA).second = PropType::NPC_DIANA;
+                        Quest.Triggers[DIANA_TRIGGER] = {Progress::ACT_II, PropType::NPC_DIANA}; 
                     }
                     break;
                 }
                 case PropType::NPC_JADE:
                 {
-                    QuestlineProgress.at(PropType::NPC_JADE).first = Progress::ACT_II;
-                    QuestlineProgress.at(PropType::NPC_JADE).second = PropType::NPC_SON;
+                    Quest.Triggers[JADE_TRIGGER] = {Progress::ACT_II, PropType::NPC_SON};
                     ReadyToProgress = true;
                     break;
                 }
@@ -490,8 +557,7 @@ void Prop::UpdateNpcActive()
                 }
                 case PropType::NPC_RUMBY:
                 {
-                    QuestlineProgress.at(PropType::NPC_RUMBY).first = Progress::ACT_II;
-                    QuestlineProgress.at(PropType::NPC_RUMBY).second = PropType::NPC_RUMBY;
+                    Quest.Triggers[RUMBY_TRIGGER] = {Progress::ACT_II, PropType::NPC_RUMBY};
                     break;
                 }
                 default:
@@ -505,29 +571,25 @@ void Prop::UpdateNpcActive()
             {
                 case PropType::NPC_DIANA:
                 {
-                    QuestlineProgress.at(PropType::NPC_DIANA).first = Progress::ACT_I; 
-                    QuestlineProgress.at(PropType::NPC_DIANA).second = PropType::NPC_DIANA;
+                    Quest.Triggers[DIANA_TRIGGER] = {Progress::ACT_I, PropType::NPC_DIANA}; 
                     break;
                 }
                 case PropType::NPC_JADE:
                 {
-                    QuestlineProgress.at(PropType::NPC_JADE).first = Progress::ACT_III;
-                    QuestlineProgress.at(PropType::NPC_JADE).second = PropType::NPC_JADE;
+                    Quest.Triggers[JADE_TRIGGER] = {Progress::ACT_III, PropType::NPC_JADE};
                     ReadyToProgress = true;
                     break;
                 }
                 case PropType::NPC_SON:
                 {
-                    QuestlineProgress.at(PropType::NPC_SON).first = Progress::ACT_II;
-                    QuestlineProgress.at(PropType::NPC_SON).second = PropType::NPC_JADE;
-                    SonSaved = true;
+                    Quest.Triggers[SON_TRIGGER] = {Progress::ACT_II, PropType::NPC_JADE};
+                    Quest.SonSaved = true;
                     ReadyToProgress = true;
                     break;
                 }
                 case PropType::NPC_RUMBY:
                 {
-                    QuestlineProgress.at(PropType::NPC_RUMBY).first = Progress::ACT_III;
-                    QuestlineProgress.at(PropType::NPC_RUMBY).second = PropType::NPC_RUMBY;
+                    Quest.Triggers[RUMBY_TRIGGER] = {Progress::ACT_III, PropType::NPC_RUMBY};
                     break;
                 }
                 default:
@@ -541,7 +603,7 @@ void Prop::UpdateNpcActive()
             {
                 case PropType::NPC_JADE:
                 {
-                    if (PiecesReceived >= 1) {
+                    if (Quest.PiecesReceived >= 1) {
                         Act = Progress::ACT_IV;
                     }
                     else {
@@ -551,7 +613,7 @@ void Prop::UpdateNpcActive()
                 }
                 case PropType::NPC_SON:
                 {
-                    if (PiecesReceived >= 1) {
+                    if (Quest.PiecesReceived >= 1) {
                         Act = Progress::ACT_IV;
                     }
                     ReadyToProgress = true;
@@ -559,8 +621,7 @@ void Prop::UpdateNpcActive()
                 }
                 case PropType::NPC_RUMBY:
                 {
-                    QuestlineProgress.at(PropType::NPC_RUMBY).first = Progress::ACT_IV;
-                    QuestlineProgress.at(PropType::NPC_RUMBY).second = PropType::NPC_RUMBY;
+                    Quest.Triggers[RUMBY_TRIGGER] = {Progress::ACT_IV, PropType::NPC_RUMBY};
                     break;
                 }
                 default:
@@ -584,8 +645,7 @@ void Prop::UpdateNpcActive()
                 }
                 case PropType::NPC_RUMBY:
                 {
-                    QuestlineProgress.at(PropType::NPC_RUMBY).first = Progress::ACT_I;
-                    QuestlineProgress.at(PropType::NPC_RUMBY).second = PropType::NPC_RUMBY;
+                    Quest.Triggers[RUMBY_TRIGGER] = {Progress::ACT_I, PropType::NPC_RUMBY};
                     break;
                 }
                 default:
@@ -622,9 +682,8 @@ void Prop::UpdateNpcActive()
             {
                 case PropType::NPC_DIANA:
                 {
-                    QuestlineProgress.at(PropType::NPC_DIANA).first = Progress::ACT_VI; 
-                    QuestlineProgress.at(PropType::NPC_DIANA).second = PropType::NPC_DIANA;
-                    FinalChestKey = true;
+                    Quest.Triggers[DIANA_TRIGGER] = {Progress::ACT_VI, PropType::NPC_DIANA}; 
+                    Quest.FinalChestKey = true;
                     break;
                 }
                 default:
@@ -647,8 +706,7 @@ void Prop::UpdateNpcActive()
             {
                 case PropType::NPC_DIANA:
                 {
-                    QuestlineProgress.at(PropType::NPC_DIANA).first = Progress::ACT_VIII; 
-                    QuestlineProgress.at(PropType::NPC_DIANA).second = PropType::NPC_DIANA;
+                    Quest.Triggers[DIANA_TRIGGER] = {Progress::ACT_VIII, PropType::NPC_DIANA}; 
                     break;
                 }
                 default:
@@ -672,24 +730,24 @@ void Prop::UpdateNewInfo()
                 MuteNewInfo = true;
             }
 
-            if (PiecesReceived >= 1 && Act == Progress::ACT_I) {
+            if (Quest.PiecesReceived >= 1 && Act == Progress::ACT_I) {
                 NewInfo = true;
             }
 
-            if (PiecesAdded >= 1 && PiecesAdded <= 5 && Act == Progress::ACT_IV && !ReadyToProgress) {
+            if (Quest.PiecesAdded >= 1 && Quest.PiecesAdded <= 5 && Act == Progress::ACT_IV && !ReadyToProgress) {
                 NewInfo = true;
             }
 
-            if (CryptexReceived && !MuteNewInfo) {
+            if (Quest.CryptexReceived && !MuteNewInfo) {
                 NewInfo = true;
                 MuteNewInfo = true;
             }
 
-            if (PiecesAdded == 6 && (Act == Progress::ACT_IV || Act == Progress::ACT_V)) {
+            if (Quest.PiecesAdded == 6 && (Act == Progress::ACT_IV || Act == Progress::ACT_V)) {
                 NewInfo = true;
             }
 
-            if (PiecesAdded == 6 && !FinalChestKey) {
+            if (Quest.PiecesAdded == 6 && !Quest.FinalChestKey) {
                 NewInfo = true;
             }
 
@@ -711,7 +769,7 @@ void Prop::UpdateNewInfo()
                 NewInfo = true;
             }
 
-            if (PiecesReceived >= 1 && (Act == Progress::ACT_II || Act == Progress::ACT_III)) {
+            if (Quest.PiecesReceived >= 1 && (Act == Progress::ACT_II || Act == Progress::ACT_III)) {
                 NewInfo = true;
             }
 
@@ -740,7 +798,7 @@ void Prop::UpdateNewInfo()
                 ReadyToProgress = true;
             }
 
-            if (PiecesReceived >= 1 && PiecesReceived <= 4 && ReadyToProgress) {
+            if (Quest.PiecesReceived >= 1 && Quest.PiecesReceived <= 4 && ReadyToProgress) {
                 NewInfo = true;
                 ReadyToProgress = false;
             }
@@ -761,7 +819,7 @@ void Prop::UpdateNewInfo()
 
 void Prop::CheckFinalChest()
 {
-    if (Type == PropType::BIGTREASURE && FinalChestSpawned) {
+    if (Type == PropType::BIGTREASURE && Quest.FinalChestSpawned) {
         Spawned = true;
     }
 }
@@ -769,10 +827,10 @@ void Prop::CheckFinalChest()
 bool Prop::WithinScreen(const Vector2 CharacterWorldPos)
 {
     if (
-        (WorldPos.x >= (CharacterWorldPos.x + 615.f) - static_cast<float>((GetScreenWidth()/2 + (Object.Texture.width * Scale)))) && 
-        (WorldPos.x <= (CharacterWorldPos.x + 615.f) + static_cast<float>((GetScreenWidth()/2 + (Object.Texture.width * Scale)))) &&
-        (WorldPos.y >= (CharacterWorldPos.y + 335.f) - static_cast<float>((GetScreenHeight()/2 + (Object.Texture.height * Scale)))) && 
-        (WorldPos.y <= (CharacterWorldPos.y + 335.f) + static_cast<float>((GetScreenHeight()/2 + (Object.Texture.height * Scale))))
+        (WorldPos.x >= (CharacterWorldPos.x + 615.f) - static_cast<float>((Platform::GetScreenWidth()/2 + (Object.Texture.width * Scale)))) && 
+        (WorldPos.x <= (CharacterWorldPos.x + 615.f) + static_cast<float>((Platform::GetScreenWidth()/2 + (Object.Texture.width * Scale)))) &&
+        (WorldPos.y >= (CharacterWorldPos.y + 335.f) - static_cast<float>((Platform::GetScreenHeight()/2 + (Object.Texture.height * Scale)))) && 
+        (WorldPos.y <= (CharacterWorldPos.y + 335.f) + static_cast<float>((Platform::GetScreenHeight()/2 + (Object.Texture.height * Scale))))
        ) {
             return true;
          }
@@ -781,18 +839,33 @@ bool Prop::WithinScreen(const Vector2 CharacterWorldPos)
     }
 }
 
-Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
+Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos) const
 {
-    Vector2 ScreenPos {Vector2Subtract(WorldPos, CharacterWorldPos)};
+    return Rectangle{CollisionRec.x - CharacterWorldPos.x, CollisionRec.y - CharacterWorldPos.y, CollisionRec.width, CollisionRec.height};
+}
+
+Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos) const
+{
+    return Rectangle{InteractRec.x - CharacterWorldPos.x, InteractRec.y - CharacterWorldPos.y, InteractRec.width, InteractRec.height};
+}
+
+void Prop::UpdateShapes()
+{
+    // World-space shapes only change when the prop moves, so the type switch runs once per move
+    CollisionRec = CalculateCollisionRec();
+    InteractRec = CalculateInteractRec();
+}
 
+Rectangle Prop::CalculateCollisionRec() const
+{
     switch (Type)
     {
         case PropType::ALTAR:
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 Object.Texture.width * Scale,
                 Object.Texture.height * Scale
             };
@@ -801,8 +874,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 (Object.Texture.width * Scale) / Object.MaxFramesX,
                 (Object.Texture.height * Scale) / Object.MaxFramesY
             };
@@ -811,8 +884,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + ((Object.Texture.width*.23f) * Scale),
-                ScreenPos.y + ((Object.Texture.height*.75f) * Scale),
+                WorldPos.x + ((Object.Texture.width*.23f) * Scale),
+                WorldPos.y + ((Object.Texture.height*.75f) * Scale),
                 (Object.Texture.width - Object.Texture.width*.35f) * Scale,
                 (Object.Texture.height - Object.Texture.height*.75f) * Scale
             };
@@ -821,8 +894,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 Object.Texture.width * Scale,
                 Object.Texture.height * Scale
             };
@@ -831,8 +904,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 (Object.Texture.width - Object.Texture.width*.125f) * Scale,
                 (Object.Texture.height - Object.Texture.height*.125f) * Scale   
             };
@@ -841,8 +914,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 Object.Texture.width * Scale,
                 Object.Texture.height * Scale
             };
@@ -851,8 +924,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y + (Object.Texture.height * Scale) * .1f,
+                WorldPos.x,
+                WorldPos.y + (Object.Texture.height * Scale) * .1f,
                 Object.Texture.width * Scale,
                 (Object.Texture.height * Scale) * .9f
             };
@@ -861,8 +934,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale) * .05f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .4f,
+                WorldPos.x + (Object.Texture.width * Scale) * .05f,
+                WorldPos.y + (Object.Texture.height * Scale) * .4f,
                 (Object.Texture.width - Object.Texture.width * .875f) * Scale,
                 (Object.Texture.height - Object.Texture.height * .65f) * Scale
             };
@@ -871,8 +944,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale) * .08f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .6f,
+                WorldPos.x + (Object.Texture.width * Scale) * .08f,
+                WorldPos.y + (Object.Texture.height * Scale) * .6f,
                 (Object.Texture.width * Scale) * .43f,
                 (Object.Texture.height * Scale) * .3f
             };
@@ -881,8 +954,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale) * .75f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .6f,
+                WorldPos.x + (Object.Texture.width * Scale) * .75f,
+                WorldPos.y + (Object.Texture.height * Scale) * .6f,
                 (Object.Texture.width * Scale) * .19f,
                 (Object.Texture.height * Scale) * .3f
             };
@@ -891,8 +964,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale) * .08f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .6f,
+                WorldPos.x + (Object.Texture.width * Scale) * .08f,
+                WorldPos.y + (Object.Texture.height * Scale) * .6f,
                 (Object.Texture.width * Scale) * .10f,
                 (Object.Texture.height * Scale) * .35f
             };
@@ -902,8 +975,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
             return Rectangle
             {
                 
-                ScreenPos.x + (Object.Texture.width * Scale) * .40f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .6f,
+                WorldPos.x + (Object.Texture.width * Scale) * .40f,
+                WorldPos.y + (Object.Texture.height * Scale) * .6f,
                 (Object.Texture.width * Scale) * .50f,
                 (Object.Texture.height * Scale) * .35f
             };
@@ -912,8 +985,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale) * .31f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .20f,
+                WorldPos.x + (Object.Texture.width * Scale) * .31f,
+                WorldPos.y + (Object.Texture.height * Scale) * .20f,
                 (Object.Texture.width * Scale) - (Object.Texture.width * Scale) * .59f,
                 (Object.Texture.height * Scale) * .35f
             };
@@ -922,8 +995,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 Object.Texture.width * Scale,
                 (Object.Texture.height * Scale) * .3f
             };
@@ -932,8 +1005,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle   
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 (Object.Texture.width * Scale) * .2f,
                 Object.Texture.height * Scale
             };
@@ -942,8 +1015,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale) * .8f,
-                ScreenPos.y,
+                WorldPos.x + (Object.Texture.width * Scale) * .8f,
+                WorldPos.y,
                 (Object.Texture.width * Scale) * .2f,
                 Object.Texture.height * Scale
             };
@@ -952,8 +1025,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 Object.Texture.width * Scale,
                 Object.Texture.height * Scale
             };
@@ -962,8 +1035,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 Object.Texture.width * Scale,
                 Object.Texture.height * Scale
             };
@@ -972,8 +1045,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale) * .1f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .2f,
+                WorldPos.x + (Object.Texture.width * Scale) * .1f,
+                WorldPos.y + (Object.Texture.height * Scale) * .2f,
                 (Object.Texture.width * Scale) * .8f,
                 (Object.Texture.height * Scale) * .7f
             };
@@ -982,8 +1055,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale) * .31f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .20f,
+                WorldPos.x + (Object.Texture.width * Scale) * .31f,
+                WorldPos.y + (Object.Texture.height * Scale) * .20f,
                 (Object.Texture.width * Scale) - (Object.Texture.width * Scale) * .59f,
                 (Object.Texture.height * Scale) * .35f
             };
@@ -992,8 +1065,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y + (Object.Texture.height * Scale) * .20f,
+                WorldPos.x,
+                WorldPos.y + (Object.Texture.height * Scale) * .20f,
                 (Object.Texture.width * Scale) - (Object.Texture.width * Scale) * .70f,
                 (Object.Texture.height * Scale) * .80f
             };
@@ -1002,8 +1075,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale) * .72f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .20f,
+                WorldPos.x + (Object.Texture.width * Scale) * .72f,
+                WorldPos.y + (Object.Texture.height * Scale) * .20f,
                 (Object.Texture.width * Scale) - (Object.Texture.width * Scale) * .70f,
                 (Object.Texture.height * Scale) * .80f
             };
@@ -1012,8 +1085,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale)/4.f * .10f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .10f,
+                WorldPos.x + (Object.Texture.width * Scale)/4.f * .10f,
+                WorldPos.y + (Object.Texture.height * Scale) * .10f,
                 (Object.Texture.width * Scale)/4.f - (Object.Texture.width * Scale)/4.f * .10f,
                 Object.Texture.height * Scale - (Object.Texture.height * Scale) * .10f
             };
@@ -1022,8 +1095,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale)/4.f * .10f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .10f,
+                WorldPos.x + (Object.Texture.width * Scale)/4.f * .10f,
+                WorldPos.y + (Object.Texture.height * Scale) * .10f,
                 (Object.Texture.width * Scale)/4.f - (Object.Texture.width * Scale)/4.f * .10f,
                 Object.Texture.height * Scale - (Object.Texture.height * Scale) * .10f
             };
@@ -1032,8 +1105,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale)/4.f * .10f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .10f,
+                WorldPos.x + (Object.Texture.width * Scale)/4.f * .10f,
+                WorldPos.y + (Object.Texture.height * Scale) * .10f,
                 (Object.Texture.width * Scale)/4.f - (Object.Texture.width * Scale)/4.f * .10f,
                 Object.Texture.height * Scale - (Object.Texture.height * Scale) * .10f
             };
@@ -1042,8 +1115,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale)/4.f * .10f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .10f,
+                WorldPos.x + (Object.Texture.width * Scale)/4.f * .10f,
+                WorldPos.y + (Object.Texture.height * Scale) * .10f,
                 (Object.Texture.width * Scale)/4.f - (Object.Texture.width * Scale)/4.f * .10f,
                 Object.Texture.height * Scale - (Object.Texture.height * Scale) * .10f
             };
@@ -1052,8 +1125,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale)/4.f * .10f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .10f,
+                WorldPos.x + (Object.Texture.width * Scale)/4.f * .10f,
+                WorldPos.y + (Object.Texture.height * Scale) * .10f,
                 (Object.Texture.width * Scale)/4.f - (Object.Texture.width * Scale)/4.f * .10f,
                 Object.Texture.height * Scale - (Object.Texture.height * Scale) * .10f
             };
@@ -1062,8 +1135,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x + (Object.Texture.width * Scale)/4.f * .10f,
-                ScreenPos.y + (Object.Texture.height * Scale) * .10f,
+                WorldPos.x + (Object.Texture.width * Scale)/4.f * .10f,
+                WorldPos.y + (Object.Texture.height * Scale) * .10f,
                 (Object.Texture.width * Scale)/4.f - (Object.Texture.width * Scale)/4.f * .10f,
                 Object.Texture.height * Scale - (Object.Texture.height * Scale) * .10f
             };
@@ -1072,8 +1145,8 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 Object.Texture.width * Scale,
                 Object.Texture.height * Scale
             };
@@ -1081,18 +1154,16 @@ Rectangle Prop::GetCollisionRec(const Vector2 CharacterWorldPos)
     }
 }
 
-Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
+Rectangle Prop::CalculateInteractRec() const
 {
-    Vector2 ScreenPos {Vector2Subtract(WorldPos, CharacterWorldPos)};
-
     switch (Type)
     {
         case PropType::STUMP:
         {
             return Rectangle
             {
-                ScreenPos.x - (Object.Texture.width * Scale) * .10f,
-                ScreenPos.y - (Object.Texture.height * Scale) * .10f,
+                WorldPos.x - (Object.Texture.width * Scale) * .10f,
+                WorldPos.y - (Object.Texture.height * Scale) * .10f,
                 Object.Texture.width * Scale + (Object.Texture.width * Scale) * .20f,
                 Object.Texture.height * Scale + (Object.Texture.height * Scale) * .20f
             };
@@ -1101,8 +1172,8 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x - (Object.Texture.width * Scale)/4.f * .45f,
-                ScreenPos.y - (Object.Texture.height * Scale) * .45f,
+                WorldPos.x - (Object.Texture.width * Scale)/4.f * .45f,
+                WorldPos.y - (Object.Texture.height * Scale) * .45f,
                 (Object.Texture.width * Scale)/4.f + (Object.Texture.width * Scale)/4.f,
                 (Object.Texture.height * Scale) + (Object.Texture.height * Scale)
             };
@@ -1111,8 +1182,8 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x - (Object.Texture.width * Scale)/4.f * .45f,
-                ScreenPos.y - (Object.Texture.height * Scale) * .45f,
+                WorldPos.x - (Object.Texture.width * Scale)/4.f * .45f,
+                WorldPos.y - (Object.Texture.height * Scale) * .45f,
                 (Object.Texture.width * Scale)/4.f + (Object.Texture.width * Scale)/4.f,
                 (Object.Texture.height * Scale) + (Object.Texture.height * Scale)
             };
@@ -1121,8 +1192,8 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x - (Object.Texture.width * Scale)/4.f * .45f,
-                ScreenPos.y - (Object.Texture.height * Scale) * .45f,
+                WorldPos.x - (Object.Texture.width * Scale)/4.f * .45f,
+                WorldPos.y - (Object.Texture.height * Scale) * .45f,
                 (Object.Texture.width * Scale)/4.f + (Object.Texture.width * Scale)/4.f,
                 (Object.Texture.height * Scale) + (Object.Texture.height * Scale)
             };
@@ -1131,8 +1202,8 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x - (Object.Texture.width * Scale)/4.f * .45f,
-                ScreenPos.y - (Object.Texture.height * Scale) * .45f,
+                WorldPos.x - (Object.Texture.width * Scale)/4.f * .45f,
+                WorldPos.y - (Object.Texture.height * Scale) * .45f,
                 (Object.Texture.width * Scale)/4.f + (Object.Texture.width * Scale)/4.f,
                 (Object.Texture.height * Scale) + (Object.Texture.height * Scale)
             };
@@ -1141,8 +1212,8 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x - (Object.Texture.width * Scale)/4.f * .45f,
-                ScreenPos.y - (Object.Texture.height * Scale) * .45f,
+                WorldPos.x - (Object.Texture.width * Scale)/4.f * .45f,
+                WorldPos.y - (Object.Texture.height * Scale) * .45f,
                 (Object.Texture.width * Scale)/4.f + (Object.Texture.width * Scale)/4.f,
                 (Object.Texture.height * Scale) + (Object.Texture.height * Scale)
             };
@@ -1151,8 +1222,8 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x - (Object.Texture.width * Scale)/4.f * .45f,
-                ScreenPos.y - (Object.Texture.height * Scale) * .45f,
+                WorldPos.x - (Object.Texture.width * Scale)/4.f * .45f,
+                WorldPos.y - (Object.Texture.height * Scale) * .45f,
                 (Object.Texture.width * Scale)/4.f + (Object.Texture.width * Scale)/4.f,
                 (Object.Texture.height * Scale) + (Object.Texture.height * Scale)
             };
@@ -1161,8 +1232,8 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x - (Object.Texture.width * Scale) * .10f,
-                ScreenPos.y - (Object.Texture.height * Scale) * .10f,
+                WorldPos.x - (Object.Texture.width * Scale) * .10f,
+                WorldPos.y - (Object.Texture.height * Scale) * .10f,
                 (Object.Texture.width * Scale) + (Object.Texture.width * Scale) * .20f,
                 (Object.Texture.height * Scale) + (Object.Texture.height * Scale) * .20f
             };
@@ -1171,8 +1242,8 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x - ((Object.Texture.width * Scale) / Object.MaxFramesX) * .10f,
-                ScreenPos.y - (Object.Texture.height * Scale) * .10f,
+                WorldPos.x - ((Object.Texture.width * Scale) / Object.MaxFramesX) * .10f,
+                WorldPos.y - (Object.Texture.height * Scale) * .10f,
                 ((Object.Texture.width * Scale) / Object.MaxFramesX) + ((Object.Texture.width * Scale) / Object.MaxFramesX) * .20f,
                 ((Object.Texture.height * Scale) / Object.MaxFramesY) + ((Object.Texture.height * Scale) / Object.MaxFramesY) * .20f
             };
@@ -1181,8 +1252,8 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
         {
             return Rectangle
             {
-                ScreenPos.x,
-                ScreenPos.y,
+                WorldPos.x,
+                WorldPos.y,
                 (Object.Texture.width * Scale),
                 Object.Texture.height * Scale
             };
@@ -1190,7 +1261,78 @@ Rectangle Prop::GetInteractRec(const Vector2 CharacterWorldPos)
     }
 }
 
-bool Prop::CheckMovement(Background& Map, const Vector2 CharWorldPos, const Vector2 Direction, const float Speed, std::vector<std::vector<Prop>>& Props)
+Rectangle Prop::GetWorldBounds() const
+{
+    // Everything the character can bump into or interact with, in world space
+    Rectangle Bounds{CollisionRec};
+
+    if (Interactable) {
+        float Right{std::max(Bounds.x + Bounds.width, InteractRec.x + InteractRec.width)};
+        float Bottom{std::max(Bounds.y + Bounds.height, InteractRec.y + InteractRec.height)};
+        Bounds.x = std::min(Bounds.x, InteractRec.x);
+        Bounds.y = std::min(Bounds.y, InteractRec.y);
+        Bounds.width = Right - Bounds.x;
+        Bounds.height = Bottom - Bounds.y;
+    }
+
+    return Bounds;
+}
+
+bool Prop::IsStaticCollider() const
+{
+    // Anything that moves, spawns later or reacts to the character needs the full collision pass
+    return Collidable && Spawned && !Moveable && !Interactable &&
+           Type != PropType::TREASURE &&
+           Type != PropType::BIGTREASURE &&
+           Type != PropType::NPC_DIANA &&
+           Type != PropType::NPC_JADE &&
+           Type != PropType::NPC_SON &&
+           Type != PropType::NPC_RUMBY;
+}
+
+// Single-frame scenery with nothing to react to looks the same every frame, so it can be drawn once into a BakedLayer
+bool Prop::IsBakeable() const
+{
+    return Spawned && !Invisible && !Interactable &&
+           Object.MaxFramesX == 1 && Object.MaxFramesY == 1 &&
+           Type != PropType::TREASURE &&
+           Type != PropType::BIGTREASURE &&
+           Type != PropType::ANIMATEDALTAR &&
+           Type != PropType::NPC_DIANA &&
+           Type != PropType::NPC_JADE &&
+           Type != PropType::NPC_SON &&
+           Type != PropType::NPC_RUMBY;
+}
+
+bool Prop::CanMove() const
+{
+    return (Moveable && Type == PropType::BOULDER) ||
+           Type == PropType::NPC_DIANA ||
+           Type == PropType::NPC_JADE ||
+           Type == PropType::NPC_SON ||
+           Type == PropType::NPC_RUMBY;
+}
+
+Rectangle Prop::GetDrawRec() const
+{
+    return Rectangle{
+        WorldPos.x,
+        WorldPos.y,
+        static_cast<float>(Object.Texture.width/Object.MaxFramesX) * Scale,
+        static_cast<float>(Object.Texture.height/Object.MaxFramesY) * Scale
+    };
+}
+
+Rectangle Prop::GetCullBounds() const
+{
+    // WithinScreen() passes when WorldPos is within half a screen plus one texture of the camera centre,
+    // so padding WorldPos by one texture turns that test into a plain overlap with the camera rectangle
+    float Width{Object.Texture.width * Scale};
+    float Height{Object.Texture.height * Scale};
+    return Rectangle{WorldPos.x - Width, WorldPos.y - Height, Width * 2.f, Height * 2.f};
+}
+
+bool Prop::CheckMovement(Background& Map, const Vector2 Direction, const float Speed, SpatialGrid<Prop>& Grid, const CollisionMask& Mask)
 {
     bool Colliding{false};
     PrevWorldPos = WorldPos;
@@ -1198,6 +1340,7 @@ bool Prop::CheckMovement(Background& Map, const Vector2 CharWorldPos, const Vect
     if (Vector2Length(Direction) != 0.f) {
         // set MapPos -= Direction
         WorldPos = Vector2Add(WorldPos, Vector2Scale(Vector2Normalize(Direction), Speed));
+        UpdateShapes();
     }
 
     if (WorldPos.x < 0.f ||
@@ -1212,15 +1355,28 @@ bool Prop::CheckMovement(Background& Map, const Vector2 CharWorldPos, const Vect
         OutOfBounds = false;
     }
 
-    for (auto& Proptype:Props) {
-        for (auto& Prop:Proptype) {
-            if (Prop.HasCollision()) {
-                if (CheckCollisionRecs(GetCollisionRec(CharWorldPos), Prop.GetCollisionRec(CharWorldPos))) {
-                    if (!Prop.IsMoveable()) {
-                        UndoMovement();
-                        Colliding = true;
-                    }
-                }
+    // Walls, houses, trees and the like
+    if (Mask.IsBlocked(CollisionRec)) {
+        UndoMovement();
+        Colliding = true;
+    }
+
+    // Cover both the pushed and the previous position, since a blocked push snaps back mid-loop
+    Vector2 Step{Vector2Subtract(PrevWorldPos, WorldPos)};
+    Rectangle Area{
+        CollisionRec.x + std::min(0.f, Step.x),
+        CollisionRec.y + std::min(0.f, Step.y),
+        CollisionRec.width + std::abs(Step.x),
+        CollisionRec.height + std::abs(Step.y)
+    };
+
+    // Only colliders near the boulder can block it
+    Grid.Query(Area, Neighbours);
+    for (auto Nearby:Neighbours) {
+        if (CheckCollisionRecs(CollisionRec, Nearby->GetWorldCollisionRec())) {
+            if (!Nearby->IsMoveable()) {
+                UndoMovement();
+                Colliding = true;
             }
         }
     }
@@ -1229,36 +1385,38 @@ bool Prop::CheckMovement(Background& Map, const Vector2 CharWorldPos, const Vect
 
 void Prop::DrawPropText()
 {
+    Profiler::Scope Timer{Profiler::Zone::DIALOGUE};
+
     if (Type == PropType::TREASURE) {
         DrawText("", 510, 550, 20, WHITE);
         DrawText("", 510, 575, 20, WHITE);
-        DrawText(TextFormat("Received: %s!", ItemName.c_str()), 490, 625, 20, WHITE);
+        DrawText(TextFormat("Received: %s!", GetItemName(ItemType)), 490, 625, 20, WHITE);
         DrawText("", 510, 625, 20, WHITE);
         DrawText("", 510, 650, 20, WHITE);
         DrawText("                                               (ENTER to Continue)", 390, 675, 16, WHITE);
 
-        if (IsKeyPressed(KEY_ENTER)) {
+        if (Platform::IsKeyPressed(KEY_ENTER)) {
             ReceiveItem = false;
         }
     }
     else if (Type == PropType::BIGTREASURE) {
-        DrawText(TextFormat("Received: %s!", ItemName.c_str()), 510, 600, 20, WHITE);
+        DrawText(TextFormat("Received: %s!", GetItemName(ItemType)), 510, 600, 20, WHITE);
         DrawText("This might look good on Diana...", 510, 625, 20, WHITE);
         DrawText("Lets bring it back to her!", 510, 650, 20, WHITE);
         DrawText("                                               (ENTER to Continue)", 390, 675, 16, WHITE);
 
-        if (IsKeyPressed(KEY_ENTER)) {
+        if (Platform::IsKeyPressed(KEY_ENTER)) {
             ReceiveItem = false;
         }
     }
     else if (Type == PropType::ANIMATEDALTAR) {
-        if (PiecesAdded == 0 || !FirstPieceInserted) {
+        if (Quest.PiecesAdded == 0 || !Quest.FirstPieceInserted) {
             DrawText("A mysterious altar... You feel", 490, 600, 20, WHITE);
             DrawText("a strange power resonating", 490, 625, 20, WHITE);
             DrawText("from the engravings...", 490, 650, 20, WHITE);
             DrawText("                                               (ENTER to Continue)", 390, 675, 16, WHITE);
         }
-        else if (PiecesAdded > 0 && PiecesAdded < 6) {
+        else if (Quest.PiecesAdded > 0 && Quest.PiecesAdded < 6) {
             DrawText("", 510, 550, 20, WHITE);
             DrawText("", 510, 575, 20, WHITE);
             DrawText("Altar piece inserted!", 510, 625, 20, WHITE);
@@ -1274,7 +1432,7 @@ void Prop::DrawPropText()
             DrawText("                                               (ENTER to Continue)", 390, 675, 16, WHITE);
         }
 
-        if (IsKeyPressed(KEY_ENTER)) {
+        if (Platform::IsKeyPressed(KEY_ENTER)) {
             InsertPiece = false;
         }
     }
@@ -1286,7 +1444,7 @@ void Prop::DrawPropText()
         DrawText("this spot super secret!", 390, 650, 20, WHITE);
         DrawText("                                                         (ENTER to Continue)", 390, 675, 16, WHITE);
 
-        if (IsKeyReleased(KEY_ENTER)) {
+        if (Platform::IsKeyReleased(KEY_ENTER)) {
             Reading = false;
             Opened = true;
             PageOpen = false;
@@ -1297,6 +1455,8 @@ void Prop::DrawPropText()
 
 void Prop::DrawSpeech()
 {
+    Profiler::Scope Timer{Profiler::Zone::DIALOGUE};
+
     switch(Act)
     {
         case Progress::ACT_I:
@@ -1346,7 +1506,7 @@ void Prop::DrawSpeech()
                     break;
             }
             
-            if (IsKeyReleased(KEY_ENTER)) {
+            if (Platform::IsKeyReleased(KEY_ENTER)) {
                 if (Type == PropType::NPC_DIANA || Type == PropType::NPC_RUMBY) {
                     Act = Progress::ACT_II;
                 }
@@ -1407,7 +1567,7 @@ void Prop::DrawSpeech()
                     break;
             }
             
-            if (IsKeyPressed(KEY_ENTER)) {
+            if (Platform::IsKeyPressed(KEY_ENTER)) {
                 if (Type == PropType::NPC_RUMBY) {
                     Act = Progress::ACT_III;
                 }
@@ -1468,7 +1628,7 @@ void Prop::DrawSpeech()
                     break;
             }
             
-            if (IsKeyPressed(KEY_ENTER)) {
+            if (Platform::IsKeyPressed(KEY_ENTER)) {
                 if (Type == PropType::NPC_RUMBY) {
                     Act = Progress::ACT_IV;
                 }
@@ -1529,7 +1689,7 @@ void Prop::DrawSpeech()
                     break;
             }
             
-            if (IsKeyPressed(KEY_ENTER)) {
+            if (Platform::IsKeyPressed(KEY_ENTER)) {
                 Opened = true;
                 Talking = false;
                 PageOpen = false;
@@ -1585,7 +1745,7 @@ void Prop::DrawSpeech()
                     break;
             }
             
-            if (IsKeyPressed(KEY_ENTER)) {
+            if (Platform::IsKeyPressed(KEY_ENTER)) {
                 Opened = true;
                 Talking = false;
                 PageOpen = false;
@@ -1621,7 +1781,7 @@ void Prop::DrawSpeech()
                     break;
             }
             
-            if (IsKeyPressed(KEY_ENTER)) {
+            if (Platform::IsKeyPressed(KEY_ENTER)) {
                 if (Type == PropType::NPC_DIANA) {
                     Act = Progress::ACT_VII;
                 }
@@ -1662,7 +1822,7 @@ void Prop::DrawSpeech()
                     break;
             }
             
-            if (IsKeyPressed(KEY_ENTER)) {
+            if (Platform::IsKeyPressed(KEY_ENTER)) {
                 Opened = true;
                 Talking = false;
                 PageOpen = false;
@@ -1718,7 +1878,7 @@ void Prop::DrawSpeech()
                     break;
             }
             
-            if (IsKeyPressed(KEY_ENTER)) {
+            if (Platform::IsKeyPressed(KEY_ENTER)) {
                 if (Type == PropType::NPC_DIANA) {
                     Act = Progress::ACT_IX;
                 }
@@ -1749,7 +1909,7 @@ void Prop::DrawSpeech()
                     break;
             }
             
-            if (IsKeyPressed(KEY_ENTER)) {
+            if (Platform::IsKeyPressed(KEY_ENTER)) {
                 Opened = true;
                 Talking = false;
                 PageOpen = false;
@@ -1791,4 +1951,159 @@ Props::Props(const std::vector<std::vector<Prop>>& Under, const std::vector<std:
     : Under{Under}, Over{Over}
 {
 
-}
\ No newline at end of file
+}
+
+void Props::BuildGrids(std::vector<Prop>& Trees, const Vector2 WorldSize)
+{
+    ResetGrids(WorldSize);
+
+    auto Register = [this](SpatialGrid<Prop>& Grid, VisibleSet& Visible, Prop& Object) {
+        Visible.Insert(Object);
+
+        // Plain blockers only need an occupancy test, everything else keeps its per-prop handling
+        if (Object.IsStaticCollider()) {
+            StaticMask.Add(Object.GetWorldCollisionRec());
+            StaticGrid.Insert(Object, Object.GetWorldCollisionRec());
+        }
+        else if (Object.HasCollision()) {
+            Grid.Insert(Object, Object.GetWorldBounds());
+        }
+    };
+
+    // Registration follows container order so queries visit props in the same order a full scan did
+    for (auto& Proptype:Under) {
+        for (auto& Prop:Proptype) {
+            Register(UnderGrid, UnderVisible, Prop);
+        }
+    }
+
+    for (auto& Proptype:Over) {
+        for (auto& Prop:Proptype) {
+            Register(OverGrid, OverVisible, Prop);
+        }
+    }
+
+    for (auto& Tree:Trees) {
+        TreeVisible.Insert(Tree);
+
+        if (Tree.HasCollision() && Tree.IsSpawned()) {
+            StaticMask.Add(Tree.GetWorldCollisionRec());
+            StaticGrid.Insert(Tree, Tree.GetWorldCollisionRec());
+        }
+    }
+
+    TrackMovers();
+}
+
+void Props::ResetGrids(const Vector2 WorldSize)
+{
+    UnderGrid = SpatialGrid<Prop>{WorldSize};
+    OverGrid = SpatialGrid<Prop>{WorldSize};
+    StaticMask = CollisionMask{WorldSize};
+    StaticGrid = SpatialGrid<Prop>{WorldSize};
+    UnderVisible.Clear(WorldSize);
+    OverVisible.Clear(WorldSize);
+    TreeVisible.Clear(WorldSize);
+
+    Movers.clear();
+}
+
+// Once the grids hold every prop, remembers which of them can still change position
+void Props::TrackMovers()
+{
+    auto Track = [this](SpatialGrid<Prop>& Grid, VisibleSet& Visible, Prop& Object) {
+        if (Object.CanMove()) {
+            Movers.push_back(Mover{Object.HasCollision() ? &Grid : nullptr, &Visible, &Object});
+        }
+    };
+
+    Movers.clear();
+    for (auto& Proptype:Under) {
+        for (auto& Prop:Proptype) {
+            Track(UnderGrid, UnderVisible, Prop);
+        }
+    }
+
+    for (auto& Proptype:Over) {
+        for (auto& Prop:Proptype) {
+            Track(OverGrid, OverVisible, Prop);
+        }
+    }
+}
+
+void Props::IndexRewards()
+{
+    for (auto& Chests:Rewards) {
+        Chests.clear();
+    }
+
+    for (auto& Proptype:Over) {
+        for (auto& Prop:Proptype) {
+            if (Prop.GetType() == PropType::TREASURE) {
+                Rewards[GetItemIndex(Prop.GetItemType())].push_back(&Prop);
+            }
+        }
+    }
+}
+
+void Props::SpawnReward(const ItemId Reward)
+{
+    for (auto* Chest:Rewards[GetItemIndex(Reward)]) {
+        Chest->SetSpawned(true);
+    }
+}
+
+void Props::UpdateGrids()
+{
+    for (auto& Mover:Movers) {
+        if (Mover.Grid) {
+            Mover.Grid->Move(*Mover.Item, Mover.Item->GetWorldBounds());
+        }
+        Mover.Visible->Move(*Mover.Item);
+    }
+}
+
+// ---------------------------------------------------------------------
+
+void VisibleSet::Insert(Prop& Item)
+{
+    Grid.Insert(Item, Item.GetCullBounds());
+}
+
+void VisibleSet::Move(Prop& Item)
+{
+    Grid.Move(Item, Item.GetCullBounds());
+}
+
+void VisibleSet::Clear(const Vector2 WorldSize)
+{
+    Grid = SpatialGrid<Prop>{WorldSize, 256.f};
+    Shown.clear();
+}
+
+SpatialGrid<Prop>::Baked VisibleSet::Export() const
+{
+    return Grid.Export();
+}
+
+bool VisibleSet::Import(SpatialGrid<Prop>::Baked&& Source)
+{
+    Shown.clear();
+    return Grid.Import(std::move(Source));
+}
+
+const std::vector<Prop*>& VisibleSet::Update(const Vector2 CharacterWorldPos)
+{
+    // Props drawn last frame that are no longer returned would keep a stale Visible flag otherwise
+    for (auto Item:Shown) {
+        Item->CheckVisibility(CharacterWorldPos);
+    }
+
+    float HalfWidth{static_cast<float>(Platform::GetScreenWidth()/2)};
+    float HalfHeight{static_cast<float>(Platform::GetScreenHeight()/2)};
+    Rectangle Camera{CharacterWorldPos.x + 615.f - HalfWidth, CharacterWorldPos.y + 335.f - HalfHeight, HalfWidth * 2.f, HalfHeight * 2.f};
+
+    const auto& Nearby{Grid.Query(Camera)};
+    Shown.assign(Nearby.begin(), Nearby.end());
+    return Shown;
+}
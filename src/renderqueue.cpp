@@ -0,0 +1,96 @@
+#include "renderqueue.hpp"
+#include "profiler.hpp"
+#include <array>
+#include <bit>
+
+void RenderQueue::Submit(const RenderLayer Layer, const AtlasTexture& Texture, Rectangle Source, const Rectangle Dest, const Color Tint)
+{
+    if (!Texture.Entry) {
+        return;
+    }
+    Submit(Layer, Texture.Entry->Texture, GetPageSource(Texture, Source), Dest, Tint);
+}
+
+void RenderQueue::Submit(const RenderLayer Layer, const Texture2D& Texture, const Rectangle Source, const Rectangle Dest, const Color Tint)
+{
+    std::uint32_t Index{static_cast<std::uint32_t>(Commands.size())};
+    std::uint32_t Depth{Layer == RenderLayer::WORLD ? SortableDepth(Dest.y + Dest.height) : Index};
+
+    Commands.push_back(Command{Texture, Source, Dest, Tint});
+    Entries.push_back(Entry{MakeKey(Layer, Depth, Texture.id), Index});
+}
+
+// Same placement as DrawTextureEx()
+void RenderQueue::Submit(const RenderLayer Layer, const AtlasTexture& Texture, const Vector2 Position, const float Scale, const Color Tint)
+{
+    Rectangle Source{0.f, 0.f, static_cast<float>(Texture.width), static_cast<float>(Texture.height)};
+    Rectangle Dest{Position.x, Position.y, Texture.width * Scale, Texture.height * Scale};
+
+    Submit(Layer, Texture, Source, Dest, Tint);
+}
+
+void RenderQueue::Flush()
+{
+    Profiler::Scope Timer{Profiler::Zone::RENDER_QUEUE};
+
+    Sort();
+
+    for (const auto& Entry:Entries) {
+        const Command& Sprite{Commands[Entry.Index]};
+        DrawTexturePro(Sprite.Texture, Sprite.Source, Sprite.Dest, Vector2{}, 0.f, Sprite.Tint);
+    }
+
+    Commands.clear();
+    Entries.clear();
+}
+
+std::uint64_t RenderQueue::MakeKey(const RenderLayer Layer, const std::uint32_t Depth, const unsigned int TextureId)
+{
+    return (static_cast<std::uint64_t>(Layer) << 56) |
+           (static_cast<std::uint64_t>(Depth) << 24) |
+           (static_cast<std::uint64_t>(TextureId) & 0xFFFFFF);
+}
+
+// Float bits reordered so that comparing them as unsigned integers matches comparing the floats
+std::uint32_t RenderQueue::SortableDepth(const float Depth)
+{
+    std::uint32_t Bits{std::bit_cast<std::uint32_t>(Depth)};
+    return (Bits & 0x80000000u) ? ~Bits : (Bits | 0x80000000u);
+}
+
+// LSD radix sort on the keys, a byte per pass. It is stable, so equal keys stay in submission order.
+// Bytes every key shares (the layer byte of a frame that is all WORLD, say) are skipped outright.
+void RenderQueue::Sort()
+{
+    if (Entries.empty()) {
+        return;
+    }
+
+    std::array<std::array<std::uint32_t, 256>, 8> Counts{};
+    for (const auto& Entry:Entries) {
+        for (int Byte{}; Byte < 8; ++Byte) {
+            ++Counts[Byte][(Entry.Key >> (Byte * 8)) & 0xFF];
+        }
+    }
+
+    Scratch.resize(Entries.size());
+
+    for (int Byte{}; Byte < 8; ++Byte) {
+        auto& Count{Counts[Byte]};
+        if (Count[(Entries.front().Key >> (Byte * 8)) & 0xFF] == Entries.size()) {
+            continue;
+        }
+
+        std::uint32_t Offset{};
+        for (auto& Bucket:Count) {
+            std::uint32_t Size{Bucket};
+            Bucket = Offset;
+            Offset += Size;
+        }
+
+        for (const auto& Entry:Entries) {
+            Scratch[Count[(Entry.Key >> (Byte * 8)) & 0xFF]++] = Entry;
+        }
+        Entries.swap(Scratch);
+    }
+}
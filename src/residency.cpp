@@ -0,0 +1,57 @@
+#include "residency.hpp"
+
+Residency::Residency(GameTexture& Textures, GameAudio& Audio, AssetLoader& Loader, const Area Start)
+    : Textures{Textures}, Audio{Audio}, Loader{Loader}, Current{Start}, Next{Start}
+{
+    Textures.Atlas.Upload(GetGroup(Start));
+    OpenTheme(Start);
+}
+
+void Residency::Request(const Area NextMap)
+{
+    Next = NextMap;
+    if (Next != Current) {
+        Textures.Atlas.Decode(Loader, GetGroup(Next));
+    }
+}
+
+void Residency::Finish()
+{
+    if (Next == Current) {
+        return;
+    }
+
+    // The fade usually outlasts the decode, so this rarely waits
+    Loader.Wait();
+    Textures.Atlas.Upload(GetGroup(Next));
+    Textures.Atlas.Release(GetGroup(Current));
+
+    UnloadMusicStream(GetTheme(Current));
+    GetTheme(Current) = Music{};
+    OpenTheme(Next);
+
+    Current = Next;
+}
+
+int Residency::GetGroup(const Area Map)
+{
+    return Map == Area::DUNGEON ? GameTexture::Dungeon : GameTexture::Forest;
+}
+
+Music& Residency::GetTheme(const Area Map)
+{
+    return Map == Area::DUNGEON ? Audio.DungeonTheme : Audio.ForestTheme;
+}
+
+void Residency::OpenTheme(const Area Map)
+{
+    Music& Theme{GetTheme(Map)};
+    Theme = Platform::LoadMusicStream(Map == Area::DUNGEON ? GameAudio::DungeonThemePath : GameAudio::ForestThemePath);
+    Theme.looping = true;
+    SetMusicVolume(Theme, GameAudio::ThemeVolume);
+
+    // The area's update resumes its theme when it was played before, which a fresh stream ignores
+    // unless it has been started and paused
+    PlayMusicStream(Theme);
+    PauseMusicStream(Theme);
+}
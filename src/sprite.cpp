@@ -1,6 +1,6 @@
 #include "sprite.hpp"
 
-Sprite::Sprite(const Texture2D& Texture, const int MaxFramesX, const int MaxFramesY, const float UpdateSpeed) 
+Sprite::Sprite(const AtlasTexture& Texture, const int MaxFramesX, const int MaxFramesY, const float UpdateSpeed) 
     : Texture{Texture}, MaxFramesX{MaxFramesX}, MaxFramesY{MaxFramesY}, UpdateTime{UpdateSpeed}
 {
 
@@ -0,0 +1,371 @@
+#include "textureatlas.hpp"
+#include "platform.hpp"
+#include "profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    // Width and height from the IHDR chunk, which every PNG starts with right after its signature
+    bool ReadPngSize(const char* Path, int& Width, int& Height)
+    {
+        unsigned char Header[24]{};
+        std::ifstream File{Path, std::ios::binary};
+        if (!File.read(reinterpret_cast<char*>(Header), sizeof(Header))) {
+            return false;
+        }
+
+        constexpr unsigned char Signature[]{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        if (std::memcmp(Header, Signature, sizeof(Signature)) != 0 || std::memcmp(Header + 12, "IHDR", 4) != 0) {
+            return false;
+        }
+
+        auto ReadBigEndian = [&Header](const int Offset) {
+            return (Header[Offset] << 24) | (Header[Offset + 1] << 16) | (Header[Offset + 2] << 8) | Header[Offset + 3];
+        };
+        Width = ReadBigEndian(16);
+        Height = ReadBigEndian(20);
+        return Width > 0 && Height > 0;
+    }
+
+    Image DecodeImage(const char* Path)
+    {
+        Image Source{LoadImage(Path)};
+        if (!Platform::IsHeadless()) {
+            ImageFormat(&Source, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        }
+        return Source;
+    }
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    for (auto& Page:Pages) {
+        if (Page.Texture.id > 0) {
+            UnloadTexture(Page.Texture);
+        }
+    }
+
+    for (auto& Item:Items) {
+        UnloadImage(Item.Source);
+    }
+}
+
+AtlasTexture TextureAtlas::Add(const char* Path, const int Group)
+{
+    Profiler::Scope Timer{Profiler::Zone::TEXTURE_LOAD};
+
+    // The size is all the handle needs, the pixels can wait for Decode() or Upload()
+    Image Source{ReadSize(Path)};
+
+    Entries.push_back(AtlasEntry{});
+    AtlasEntry& Entry{Entries.back()};
+    Lookup.emplace(Path, static_cast<int>(Items.size()));
+    Items.push_back(Item{Path, Source, &Entry, Group});
+
+    if (Group >= static_cast<int>(Resident.size())) {
+        Resident.resize(Group + 1, false);
+    }
+
+    return AtlasTexture{&Entry, Source.width, Source.height};
+}
+
+TiledTexture TextureAtlas::AddTiled(const char* Path, const int Group, const int TileSize)
+{
+    Profiler::Scope Timer{Profiler::Zone::TEXTURE_LOAD};
+
+    // Tiles have to fit on a shared page, a standalone one would bring the size limit back
+    TiledTexture Tiled{};
+    Image Source{ReadSize(Path)};
+    Tiled.TileSize = std::clamp(TileSize, 1, MaxPackedSize);
+    Tiled.width = Source.width;
+    Tiled.height = Source.height;
+    Tiled.Columns = (std::max(Source.width, 0) + Tiled.TileSize - 1) / Tiled.TileSize;
+    Tiled.Rows = (std::max(Source.height, 0) + Tiled.TileSize - 1) / Tiled.TileSize;
+
+    // The image itself is decoded but never packed; each tile copies its part out of it on upload
+    const int Parent{static_cast<int>(Items.size())};
+    Items.push_back(Item{Path, Source, nullptr, Group});
+
+    for (int Row = 0; Row < Tiled.Rows; ++Row) {
+        for (int Column = 0; Column < Tiled.Columns; ++Column) {
+            const int X{Column * Tiled.TileSize};
+            const int Y{Row * Tiled.TileSize};
+            Image Tile{nullptr, std::min(Tiled.TileSize, Source.width - X), std::min(Tiled.TileSize, Source.height - Y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+
+            Entries.push_back(AtlasEntry{});
+            Items.push_back(Item{Path, Tile, &Entries.back(), Group, -1, Parent, X, Y});
+            Tiled.Tiles.push_back(AtlasTexture{&Entries.back(), Tile.width, Tile.height});
+        }
+    }
+
+    if (Group >= static_cast<int>(Resident.size())) {
+        Resident.resize(Group + 1, false);
+    }
+
+    return Tiled;
+}
+
+void TextureAtlas::Decode(AssetLoader& Loader, const int Group)
+{
+    if (Platform::IsHeadless() || Resident.at(Group)) {
+        return;
+    }
+
+    // Each job owns one item, and the profiler is main thread only so the jobs aren't timed
+    for (auto& Item:Items) {
+        if (Item.Group == Group && Item.Parent < 0 && Item.Source.width > 0 && !Item.Source.data) {
+            Loader.Submit([&Item] {Item.Source = DecodeImage(Item.Path.c_str());});
+        }
+    }
+}
+
+void TextureAtlas::Upload(const int Group)
+{
+    Profiler::Scope Timer{Profiler::Zone::TEXTURE_LOAD};
+
+    if (Resident.at(Group)) {
+        return;
+    }
+    Pack();
+
+    if (!Platform::IsHeadless()) {
+        for (auto& Item:Items) {
+            if (Item.Group == Group && Item.Parent < 0 && (Item.Page >= 0 || !Item.Entry) && Item.Source.width > 0 && !Item.Source.data) {
+                Item.Source = DecodeImage(Item.Path.c_str());
+            }
+        }
+
+        // Copy each image's rows into its page and upload the pages. Headless runs have no GPU,
+        // so they keep the layout and skip the pixels.
+        for (int Index = 0; Index < GetPageCount(); ++Index) {
+            Page& Page{Pages[Index]};
+            if (Page.Group != Group) {
+                continue;
+            }
+
+            if (Page.Standalone >= 0) {
+                Page.Texture = LoadTextureFromImage(Items[Page.Standalone].Source);
+                continue;
+            }
+
+            Image Canvas{GenImageColor(Page.Texture.width, Page.Texture.height, BLANK)};
+            auto Pixels{static_cast<unsigned char*>(Canvas.data)};
+
+            for (auto& Item:Items) {
+                if (Item.Page != Index) {
+                    continue;
+                }
+
+                // Tiles copy their part of the tiled image, everything else the whole of its own
+                const Image& Owner{Item.Parent >= 0 ? Items[Item.Parent].Source : Item.Source};
+                const Rectangle& Region{Item.Entry->Region};
+                int Width{static_cast<int>(Region.width)};
+                int Height{static_cast<int>(Region.height)};
+
+                // A file changed since its header was read would overrun its slot, so it is left blank
+                if (!Owner.data || (Item.Parent < 0 && (Owner.width != Width || Owner.height != Height)) ||
+                    Owner.width < Item.OffsetX + Width || Owner.height < Item.OffsetY + Height) {
+                    continue;
+                }
+                auto Source{static_cast<const unsigned char*>(Owner.data)};
+                int Left{static_cast<int>(Region.x)};
+                int Top{static_cast<int>(Region.y)};
+
+                for (int Row = 0; Row < Height; ++Row) {
+                    std::memcpy(Pixels + ((Top + Row) * Page.Texture.width + Left) * 4,
+                                Source + ((Item.OffsetY + Row) * Owner.width + Item.OffsetX) * 4, Width * 4);
+                }
+            }
+
+            Page.Texture = LoadTextureFromImage(Canvas);
+            UnloadImage(Canvas);
+        }
+
+        // The GPU has the pixels now, only the sizes are kept for the next upload
+        for (auto& Item:Items) {
+            if (Item.Group == Group && Item.Source.data) {
+                UnloadImage(Item.Source);
+                Item.Source.data = nullptr;
+            }
+        }
+    }
+
+    Resident.at(Group) = true;
+    UpdateEntries(Group);
+}
+
+void TextureAtlas::Release(const int Group)
+{
+    if (!Resident.at(Group)) {
+        return;
+    }
+
+    for (auto& Page:Pages) {
+        if (Page.Group == Group && Page.Texture.id > 0) {
+            UnloadTexture(Page.Texture);
+            Page.Texture.id = 0;
+        }
+    }
+
+    Resident.at(Group) = false;
+    UpdateEntries(Group);
+}
+
+void TextureAtlas::Build()
+{
+    for (int Group = 0; Group < static_cast<int>(Resident.size()); ++Group) {
+        Upload(Group);
+    }
+}
+
+AtlasTexture TextureAtlas::Find(const std::string& Path) const
+{
+    auto Found{Lookup.find(Path)};
+    if (Found == Lookup.end()) {
+        return AtlasTexture{};
+    }
+
+    const Item& Match{Items[Found->second]};
+    return AtlasTexture{Match.Entry, Match.Source.width, Match.Source.height};
+}
+
+void TextureAtlas::Pack()
+{
+    if (Packed) {
+        return;
+    }
+    Packed = true;
+
+    for (int Group = 0; Group < static_cast<int>(Resident.size()); ++Group) {
+        std::vector<Item*> Shelved{};
+
+        for (int Index = 0; Index < static_cast<int>(Items.size()); ++Index) {
+            Item& Item{Items[Index]};
+            if (Item.Group != Group || !Item.Entry || Item.Source.width <= 0) {
+                continue;
+            }
+
+            if (Item.Source.width <= MaxPackedSize && Item.Source.height <= MaxPackedSize) {
+                Shelved.push_back(&Item);
+            }
+            else {
+                // Too big to share a page (maps, full screen art)
+                Item.Page = GetPageCount();
+                Item.Entry->Region = Rectangle{0.f, 0.f, static_cast<float>(Item.Source.width), static_cast<float>(Item.Source.height)};
+                Pages.push_back(Page{Group, Index, Texture2D{0, Item.Source.width, Item.Source.height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8}});
+            }
+        }
+
+        // Shelf packing: tallest first so each row wastes as little height as possible
+        std::stable_sort(Shelved.begin(), Shelved.end(), [](const Item* A, const Item* B) {
+            return A->Source.height > B->Source.height;
+        });
+
+        int FirstPage{GetPageCount()};
+        int X{PageSize};
+        int Y{};
+        int ShelfHeight{};
+
+        for (auto Item:Shelved) {
+            int Width{Item->Source.width + Padding};
+            int Height{Item->Source.height + Padding};
+
+            if (X + Width > PageSize) {
+                X = 0;
+                Y += ShelfHeight;
+                ShelfHeight = 0;
+            }
+            if (GetPageCount() == FirstPage || Y + Height > PageSize) {
+                Pages.push_back(Page{Group, -1, Texture2D{0, PageSize, 0, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8}});
+                X = 0;
+                Y = 0;
+                ShelfHeight = 0;
+            }
+
+            Item->Page = GetPageCount() - 1;
+            Item->Entry->Region = Rectangle{static_cast<float>(X), static_cast<float>(Y),
+                                            static_cast<float>(Item->Source.width), static_cast<float>(Item->Source.height)};
+
+            X += Width;
+            ShelfHeight = std::max(ShelfHeight, Height);
+            Pages.back().Texture.height = std::max(Pages.back().Texture.height, Y + Height);
+        }
+    }
+}
+
+// Just the size when the PNG header has it, the whole image otherwise
+Image TextureAtlas::ReadSize(const char* Path)
+{
+    Image Source{nullptr, 0, 0, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+    if (!ReadPngSize(Path, Source.width, Source.height)) {
+        Source = DecodeImage(Path);
+    }
+    return Source;
+}
+
+void TextureAtlas::UpdateEntries(const int Group)
+{
+    for (auto& Item:Items) {
+        if (Item.Group == Group && Item.Page >= 0) {
+            Item.Entry->Texture = Pages[Item.Page].Texture;
+        }
+    }
+}
+
+void DrawTextureEx(const AtlasTexture& Texture, Vector2 Position, float Rotation, float Scale, Color Tint)
+{
+    Rectangle Source{0.f, 0.f, static_cast<float>(Texture.width), static_cast<float>(Texture.height)};
+    Rectangle Dest{Position.x, Position.y, Texture.width * Scale, Texture.height * Scale};
+
+    DrawTexturePro(Texture, Source, Dest, Vector2{0.f, 0.f}, Rotation, Tint);
+}
+
+void DrawTexturePro(const AtlasTexture& Texture, Rectangle Source, Rectangle Dest, Vector2 Origin, float Rotation, Color Tint)
+{
+    if (!Texture.Entry) {
+        return;
+    }
+    ::DrawTexturePro(Texture.Entry->Texture, GetPageSource(Texture, Source), Dest, Origin, Rotation, Tint);
+}
+
+// Maps a source rectangle from image space into the page the image was packed into
+Rectangle GetPageSource(const AtlasTexture& Texture, Rectangle Source)
+{
+    const AtlasEntry& Entry{*Texture.Entry};
+
+    // A standalone texture repeats past its edges, and sprite sheets lean on that for the frame
+    // after their last one. Wrap by hand so a page never shows the neighbouring image instead.
+    if (Entry.Region.width > 0.f && Entry.Region.height > 0.f) {
+        Source.x = std::fmod(Source.x, Entry.Region.width);
+        Source.y = std::fmod(Source.y, Entry.Region.height);
+    }
+
+    Source.x += Entry.Region.x;
+    Source.y += Entry.Region.y;
+
+    return Source;
+}
+
+// Draws only the tiles that overlap View, in screen space
+void DrawTiles(const TiledTexture& Texture, Vector2 Position, float Scale, Rectangle View, Color Tint)
+{
+    const float TileSize{Texture.TileSize * Scale};
+    if (Texture.Tiles.empty() || TileSize <= 0.f) {
+        return;
+    }
+
+    int Left{std::max(0, static_cast<int>(std::floor((View.x - Position.x) / TileSize)))};
+    int Top{std::max(0, static_cast<int>(std::floor((View.y - Position.y) / TileSize)))};
+    int Right{std::min(Texture.Columns - 1, static_cast<int>(std::floor((View.x + View.width - Position.x) / TileSize)))};
+    int Bottom{std::min(Texture.Rows - 1, static_cast<int>(std::floor((View.y + View.height - Position.y) / TileSize)))};
+
+    for (int Row = Top; Row <= Bottom; ++Row) {
+        for (int Column = Left; Column <= Right; ++Column) {
+            Vector2 Corner{Position.x + Column * TileSize, Position.y + Row * TileSize};
+            DrawTextureEx(Texture.Tiles[Row * Texture.Columns + Column], Corner, 0.f, Scale, Tint);
+        }
+    }
+}
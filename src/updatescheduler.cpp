@@ -0,0 +1,59 @@
+#include "updatescheduler.hpp"
+#include "platform.hpp"
+#include <algorithm>
+
+UpdateScheduler::UpdateScheduler(const ActivityBudget& Budget)
+    : Budget{Budget}
+{
+
+}
+
+void UpdateScheduler::BeginStep(const Vector2 CharacterWorldPos)
+{
+    ++Step;
+
+    // Same screen centre Enemy::WithinScreen() measures from
+    Vector2 Center{CharacterWorldPos.x + 615.f, CharacterWorldPos.y + 335.f};
+    float HalfWidth{Platform::GetScreenWidth() / 2.f};
+    float HalfHeight{Platform::GetScreenHeight() / 2.f};
+
+    auto Around = [=](const float Margin) {
+        return Rectangle{
+            Center.x - HalfWidth - Margin,
+            Center.y - HalfHeight - Margin,
+            (HalfWidth + Margin) * 2.f,
+            (HalfHeight + Margin) * 2.f
+        };
+    };
+
+    Near = Around(Budget.NearMargin);
+    Mid = Around(std::max(Budget.NearMargin, Budget.MidMargin));
+}
+
+Activity UpdateScheduler::Classify(const Vector2 WorldPos) const
+{
+    if (CheckCollisionPointRec(WorldPos, Near)) {
+        return Activity::NEAR;
+    }
+    else if (CheckCollisionPointRec(WorldPos, Mid)) {
+        return Activity::MID;
+    }
+    else {
+        return Activity::FAR;
+    }
+}
+
+int UpdateScheduler::GetSteps(const Vector2 WorldPos, const int Slot) const
+{
+    int Interval{std::max(1, Budget.MidInterval)};
+
+    switch (Classify(WorldPos))
+    {
+        case Activity::NEAR:
+            return 1;
+        case Activity::MID:
+            return (Step + Slot) % Interval == 0 ? Interval : 0;
+        default:
+            return 0;
+    }
+}
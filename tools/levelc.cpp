@@ -0,0 +1,563 @@
+// levelc: compiles a level source (levels/*.level) into the binary the game maps at startup (see
+// level.hpp), with the collision grids, static collider mask and visibility grids already built.
+// The props are constructed with the game's own code to compute those, so run it from the directory
+// holding sprites/ or the image sizes, and every bound derived from them, come out wrong.
+//
+//     levelc levels/forest.level build/levels/forest.lvl
+
+#include "level.hpp"
+#include "platform.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <utility>
+#include <unordered_map>
+
+namespace
+{
+    // Names used in level sources, in enum order
+    constexpr std::array<std::string_view, 31> PropTypeNames{
+        "TREE", "ROCK", "BOULDER", "GRASS", "FLOWER", "rHOUSELEFT", "rHOUSERIGHT", "DOOR", "bHOUSELEFT", "bHOUSERIGHT",
+        "FENCE", "TOPWALL", "LEFTSIDEWALL", "RIGHTSIDEWALL", "BOTTOMWALL", "BUSH", "STUMP", "HOLE", "TREASURE", "BIGTREASURE",
+        "DUNGEON", "DUNGEONLEFT", "DUNGEONRIGHT", "ALTAR", "ANIMATEDALTAR", "NPC_O", "NPC_DIANA", "NPC_JADE", "NPC_SON", "NPC_RUMBY",
+        "PLACEHOLDER"
+    };
+    constexpr std::array<std::string_view, 18> EnemyTypeNames{
+        "BEAR", "BEHOLDER", "CREATURE", "GHOST", "IMP", "MUSHROOM", "NECROMANCER", "SHADOW", "SPIDER", "TOAD",
+        "NORMAL", "BOSS", "NPC", "FINALBOSS", "FOX", "CROW", "SQUIRREL", "DEFAULT"
+    };
+    constexpr std::array<std::string_view, 11> ProgressNames{
+        "ACT_O", "ACT_I", "ACT_II", "ACT_III", "ACT_IV", "ACT_V", "ACT_VI", "ACT_VII", "ACT_VIII", "ACT_IX", "ACT_X"
+    };
+    constexpr std::array<std::string_view, 3> LayerNames{"under", "over", "trees"};
+    constexpr std::array<std::string_view, 2> ListNames{"enemies", "crows"};
+
+    static_assert(PropTypeNames.size() == static_cast<std::size_t>(PropType::PLACEHOLDER) + 1);
+    static_assert(EnemyTypeNames.size() == static_cast<std::size_t>(EnemyType::DEFAULT) + 1);
+    static_assert(ProgressNames.size() == static_cast<std::size_t>(Progress::ACT_X) + 1);
+
+    struct LevelSource
+    {
+        std::vector<std::string> Strings{};
+        std::unordered_map<std::string, std::uint16_t> StringIndex{};
+        std::vector<LevelFormat::PropRecord> Props{};
+        std::vector<LevelFormat::EnemyRecord> Enemies{};
+    };
+
+    // Indexes the game would build at load, with every prop replaced by its record index
+    struct BakedIndexes
+    {
+        Vector2 WorldSize{};
+        std::vector<std::pair<LevelFormat::GridKind, SpatialGrid<Prop>::Baked>> Grids{};
+        std::vector<std::vector<std::uint32_t>> GridProps{};    // Per grid, in Grids order
+        const CollisionMask* Mask{nullptr};
+    };
+
+    // One line of a level source: words in order, with key=value options pulled out
+    struct Line
+    {
+        std::vector<std::string> Words{};
+        std::unordered_map<std::string, std::string> Options{};
+    };
+
+    bool Tokenize(const std::string& Text, Line& Out, std::string& Error)
+    {
+        std::size_t Pos{};
+        while (Pos < Text.size()) {
+            if (Text[Pos] == ' ' || Text[Pos] == '\t' || Text[Pos] == '\r') {
+                ++Pos;
+                continue;
+            }
+            if (Text[Pos] == '#') {
+                break;
+            }
+
+            // Values may be quoted to hold spaces, as in item="Top Altar Piece"
+            std::string Token{};
+            while (Pos < Text.size() && Text[Pos] != ' ' && Text[Pos] != '\t' && Text[Pos] != '\r') {
+                if (Text[Pos] == '"') {
+                    std::size_t Close{Text.find('"', Pos + 1)};
+                    if (Close == std::string::npos) {
+                        Error = "unterminated quote";
+                        return false;
+                    }
+                    Token += Text.substr(Pos + 1, Close - Pos - 1);
+                    Pos = Close + 1;
+                }
+                else {
+                    Token += Text[Pos++];
+                }
+            }
+
+            std::size_t Equals{Token.find('=')};
+            if (Equals != std::string::npos) {
+                Out.Options[Token.substr(0, Equals)] = Token.substr(Equals + 1);
+            }
+            else {
+                Out.Words.push_back(Token);
+            }
+        }
+        return true;
+    }
+
+    template <std::size_t Size>
+    bool ParseName(const std::array<std::string_view, Size>& Names, const std::string& Text, std::uint8_t& Out)
+    {
+        for (std::size_t Index = 0; Index < Size; ++Index) {
+            if (Names[Index] == Text) {
+                Out = static_cast<std::uint8_t>(Index);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Plain decimals, or a/b worked out in float the way 1.f/3.f is in code
+    bool ParseNumber(const std::string& Text, float& Out)
+    {
+        auto Parse = [](const std::string& Part, float& Value) {
+            char* End{nullptr};
+            Value = std::strtof(Part.c_str(), &End);
+            return !Part.empty() && *End == '\0';
+        };
+
+        std::size_t Slash{Text.find('/')};
+        if (Slash == std::string::npos) {
+            return Parse(Text, Out);
+        }
+
+        float Numerator{}, Denominator{};
+        if (!Parse(Text.substr(0, Slash), Numerator) || !Parse(Text.substr(Slash + 1), Denominator) || Denominator == 0.f) {
+            return false;
+        }
+        Out = Numerator / Denominator;
+        return true;
+    }
+
+    std::uint16_t Intern(LevelSource& Level, const std::string& Text)
+    {
+        auto [Existing, Added]{Level.StringIndex.try_emplace(Text, static_cast<std::uint16_t>(Level.Strings.size()))};
+        if (Added) {
+            Level.Strings.push_back(Text);
+        }
+        return Existing->second;
+    }
+
+    // image[:columns x rows][@seconds per frame], matching the Sprite constructor's defaults
+    bool ParseSprite(LevelSource& Level, const std::string& Text, LevelFormat::SpriteRecord& Out)
+    {
+        std::string Path{Text};
+        Out.FramesX = 1;
+        Out.FramesY = 1;
+        Out.UpdateSpeed = 1.f/8.f;
+
+        std::size_t At{Path.find('@')};
+        if (At != std::string::npos) {
+            if (!ParseNumber(Path.substr(At + 1), Out.UpdateSpeed)) {
+                return false;
+            }
+            Path.resize(At);
+        }
+
+        std::size_t Colon{Path.find(':')};
+        if (Colon != std::string::npos) {
+            unsigned FramesX{}, FramesY{};
+            char Trailing{};
+            if (std::sscanf(Path.c_str() + Colon + 1, "%ux%u%c", &FramesX, &FramesY, &Trailing) != 2 || FramesX > UINT8_MAX || FramesY > UINT8_MAX) {
+                return false;
+            }
+            Out.FramesX = static_cast<std::uint8_t>(FramesX);
+            Out.FramesY = static_cast<std::uint8_t>(FramesY);
+            Path.resize(Colon);
+        }
+
+        Out.Texture = Path == "-" ? LevelFormat::None : Intern(Level, Path);
+        return !Path.empty();
+    }
+
+    bool ParseLine(LevelSource& Level, const TextureAtlas& Atlas, const Line& Entry, std::array<int, 3>& Groups, int& Layer, std::string& Error)
+    {
+        using namespace LevelFormat;
+
+        const std::string& Kind{Entry.Words[0]};
+        std::vector<std::string> Allowed{};
+        bool Valid{true};
+
+        // Bare words after the positional ones are flags
+        const std::size_t Count{std::min<std::size_t>(Entry.Words.size(),
+            Kind == "monster" ? 12u : Kind == "npc" ? 10u : Kind == "animated" ? 6u : Kind == "prop" || Kind == "altar" ? 5u : 2u)};
+        const std::vector<std::string> Flags(Entry.Words.begin() + Count, Entry.Words.end());
+
+        auto Number = [&](const std::string& Text, float& Out) {Valid = Valid && ParseNumber(Text, Out);};
+        auto Option = [&](const std::string& Key, auto&& Apply) {
+            Allowed.push_back(Key);
+            auto Found{Entry.Options.find(Key)};
+            if (Found != Entry.Options.end()) {
+                Valid = Valid && Apply(Found->second);
+            }
+        };
+        auto Flag = [&](const std::string& Name) {
+            Allowed.push_back(Name);
+            return std::find(Flags.begin(), Flags.end(), Name) != Flags.end();
+        };
+        // An image the game never loads would only show up as a prop or enemy drawing nothing
+        auto Image = [&](const std::uint16_t Index) {
+            if (Valid && Index != None && !Atlas.Find(Level.Strings[Index]).Entry) {
+                Error = "unknown image '" + Level.Strings[Index] + "'";
+                Valid = false;
+            }
+        };
+
+        std::uint8_t Named{};
+        if (ParseName(LayerNames, Kind, Named)) {
+            // A layer line starts the next draw group of that layer, its name is only for readers
+            if (Entry.Words.size() != 2 || !Entry.Options.empty()) {
+                Error = "expected " + Kind + " <group name>";
+                return false;
+            }
+            Layer = Named;
+            ++Groups[Layer];
+            return true;
+        }
+
+        if (Kind == "prop" || Kind == "altar" || Kind == "animated") {
+            if (Layer < 0) {
+                Error = "prop before any under, over or trees group";
+                return false;
+            }
+
+            PropRecord Record{};
+            Record.Layer = static_cast<PropLayer>(Layer);
+            Record.Group = static_cast<std::uint16_t>(Groups[Layer] - 1);
+            Record.Scale = 4.f;
+            Record.TriggerNpc = static_cast<std::uint8_t>(PropType::NPC_O);
+            Record.Flags = SPAWNED;
+
+            if (Count != (Kind == "animated" ? 6u : 5u) || !ParseName(PropTypeNames, Entry.Words[1], Record.Type)) {
+                Error = "expected " + Kind + (Kind == "animated" ? " <type> <x> <y> <sprite> <item image>" : " <type> <x> <y> <image>");
+                return false;
+            }
+            Number(Entry.Words[2], Record.X);
+            Number(Entry.Words[3], Record.Y);
+            Valid = Valid && ParseSprite(Level, Entry.Words[4], Record.Sprite);
+            Image(Record.Sprite.Texture);
+
+            auto Item = [&](const std::string& Text) {return ParseName(ItemNames, Text, Record.ItemType);};
+            auto Scale = [&](const std::string& Text) {return ParseNumber(Text, Record.Scale);};
+
+            if (Kind == "prop") {
+                Record.Kind = PropKind::STATIC;
+                Valid = Valid && Record.Sprite.FramesX == 1 && Record.Sprite.FramesY == 1;
+                Option("scale", Scale);
+                Record.Flags |= (Flag("moveable") ? MOVEABLE : 0) | (Flag("interactable") ? INTERACTABLE : 0) | (Flag("invisible") ? INVISIBLE : 0);
+            }
+            else if (Kind == "altar") {
+                Record.Kind = PropKind::ALTAR;
+                Record.Flags = (Flag("spawned") ? SPAWNED : 0) | (Flag("interactable") ? INTERACTABLE : 0);
+                Option("item", Item);
+            }
+            else {
+                Record.Kind = PropKind::ANIMATED;
+                Record.ItemScale = 2.f;
+                Record.Item = Entry.Words[5] == "-" ? None : Intern(Level, Entry.Words[5]);
+                Image(Record.Item);
+                Record.Flags = (Flag("moveable") ? MOVEABLE : 0) | (Flag("interactable") ? INTERACTABLE : 0) | (Flag("hidden") ? 0 : SPAWNED);
+                Option("scale", Scale);
+                Option("act", [&](const std::string& Text) {return ParseName(ProgressNames, Text, Record.TriggerAct);});
+                Option("npc", [&](const std::string& Text) {return ParseName(PropTypeNames, Text, Record.TriggerNpc);});
+                Option("item", Item);
+                Option("itemscale", [&](const std::string& Text) {return ParseNumber(Text, Record.ItemScale);});
+            }
+
+            Level.Props.push_back(Record);
+        }
+        else if (Kind == "monster" || Kind == "npc") {
+            const bool Monster{Kind == "monster"};
+            const std::size_t Sprites{Monster ? 6u : 5u};
+            const std::size_t First{Monster ? 6u : 5u};
+
+            EnemyRecord Record{};
+            Record.Kind = Monster ? EnemyKind::MONSTER : EnemyKind::NPC;
+            Record.Type = static_cast<std::uint8_t>(EnemyType::NPC);
+            Record.BossSpawner = static_cast<std::uint8_t>(EnemyType::DEFAULT);
+            Record.Health = Monster ? 3 : 0;
+            Record.Scale = 3.2f;
+
+            std::uint8_t List{};
+            if (Count != First + Sprites || !ParseName(ListNames, Entry.Words[1], List) || !ParseName(EnemyTypeNames, Entry.Words[2], Record.Race) ||
+                (Monster && !ParseName(EnemyTypeNames, Entry.Words[3], Record.Type)))
+            {
+                Error = Monster ? "expected monster <list> <race> <type> <x> <y> <idle> <walk> <attack> <hurt> <death> <projectile>" :
+                                  "expected npc <list> <race> <x> <y> <idle> <idletwo> <walk> <misc> <sleep>";
+                return false;
+            }
+            Record.List = static_cast<EnemyList>(List);
+            Number(Entry.Words[First - 2], Record.X);
+            Number(Entry.Words[First - 1], Record.Y);
+            for (std::size_t Slot = 0; Slot < Sprites; ++Slot) {
+                Valid = Valid && ParseSprite(Level, Entry.Words[First + Slot], Record.Sprites[Slot]);
+                Image(Record.Sprites[Slot].Texture);
+            }
+
+            Option("scale", [&](const std::string& Text) {return ParseNumber(Text, Record.Scale);});
+            if (Monster) {
+                Option("health", [&](const std::string& Text) {
+                    char* End{nullptr};
+                    long Health{std::strtol(Text.c_str(), &End, 10)};
+                    Record.Health = static_cast<std::uint8_t>(Health);
+                    return *End == '\0' && Health >= 0 && Health <= UINT8_MAX;
+                });
+                Option("spawner", [&](const std::string& Text) {return ParseName(EnemyTypeNames, Text, Record.BossSpawner);});
+            }
+
+            Level.Enemies.push_back(Record);
+        }
+        else {
+            Error = "unknown entry '" + Kind + "'";
+            return false;
+        }
+
+        for (auto& [Key, Value]:Entry.Options) {
+            if (std::find(Allowed.begin(), Allowed.end(), Key) == Allowed.end()) {
+                Error = "unknown option '" + Key + "'";
+                return false;
+            }
+        }
+        for (auto& Name:Flags) {
+            if (std::find(Allowed.begin(), Allowed.end(), Name) == Allowed.end()) {
+                Error = "unknown flag '" + Name + "'";
+                return false;
+            }
+        }
+        if (!Valid && Error.empty()) {
+            Error = "malformed number, name or sprite";
+        }
+        return Valid;
+    }
+
+    bool ParseSource(const std::string& Path, const TextureAtlas& Atlas, LevelSource& Level)
+    {
+        std::ifstream Input{Path};
+        if (!Input) {
+            std::fprintf(stderr, "levelc: cannot open %s\n", Path.c_str());
+            return false;
+        }
+
+        std::array<int, 3> Groups{};
+        int Layer{-1};
+        std::string Text{};
+        for (int Number = 1; std::getline(Input, Text); ++Number) {
+            Line Entry{};
+            std::string Error{};
+            if (!Tokenize(Text, Entry, Error) || (!Entry.Words.empty() && !ParseLine(Level, Atlas, Entry, Groups, Layer, Error)) ||
+                (Entry.Words.empty() && !Entry.Options.empty()))
+            {
+                std::fprintf(stderr, "%s:%d: %s\n", Path.c_str(), Number, Error.empty() ? "malformed line" : Error.c_str());
+                return false;
+            }
+        }
+
+        if (Level.Strings.size() >= LevelFormat::None) {
+            std::fprintf(stderr, "levelc: %s uses more than %u strings\n", Path.c_str(), LevelFormat::None - 1u);
+            return false;
+        }
+        return true;
+    }
+
+    template <typename Record>
+    std::uint32_t Append(std::vector<unsigned char>& Out, const Record* Data, const std::size_t Count)
+    {
+        const auto Offset{static_cast<std::uint32_t>(Out.size())};
+        const auto* Bytes{reinterpret_cast<const unsigned char*>(Data)};
+        Out.insert(Out.end(), Bytes, Bytes + Count * sizeof(Record));
+        return Offset;
+    }
+
+    void Align(std::vector<unsigned char>& Out, const std::size_t Boundary)
+    {
+        Out.resize((Out.size() + Boundary - 1) / Boundary * Boundary);
+    }
+
+    std::vector<unsigned char> Serialize(const LevelSource& Level, const BakedIndexes* Indexes)
+    {
+        using namespace LevelFormat;
+
+        Header Head{};
+        Head.Magic = Magic;
+        Head.Version = Version;
+
+        std::vector<unsigned char> Out(sizeof(Header));
+
+        // String table: offsets, then the terminated characters padded to the next record
+        std::vector<std::uint32_t> Offsets{};
+        std::string Characters{};
+        for (auto& Text:Level.Strings) {
+            Offsets.push_back(static_cast<std::uint32_t>(Characters.size()));
+            Characters.append(Text).push_back('\0');
+        }
+        Head.StringCount = static_cast<std::uint32_t>(Offsets.size());
+        Head.StringOffset = Append(Out, Offsets.data(), Offsets.size());
+        Append(Out, Characters.data(), Characters.size());
+        Align(Out, 4);
+
+        Head.PropCount = static_cast<std::uint32_t>(Level.Props.size());
+        Head.PropOffset = Append(Out, Level.Props.data(), Level.Props.size());
+        Head.EnemyCount = static_cast<std::uint32_t>(Level.Enemies.size());
+        Head.EnemyOffset = Append(Out, Level.Enemies.data(), Level.Enemies.size());
+
+        if (Indexes) {
+            Head.WorldWidth = Indexes->WorldSize.x;
+            Head.WorldHeight = Indexes->WorldSize.y;
+
+            std::vector<GridRecord> Grids(Indexes->Grids.size());
+            Head.GridCount = static_cast<std::uint32_t>(Grids.size());
+            Head.GridOffset = Append(Out, Grids.data(), Grids.size());
+
+            for (std::size_t Index = 0; Index < Grids.size(); ++Index) {
+                const auto& [Kind, Baked]{Indexes->Grids[Index]};
+                GridRecord& Grid{Grids[Index]};
+                Grid.Kind = Kind;
+                Grid.CellSize = Baked.CellSize;
+                Grid.Columns = static_cast<std::uint32_t>(Baked.Columns);
+                Grid.Rows = static_cast<std::uint32_t>(Baked.Rows);
+
+                std::vector<GridEntry> Entries{};
+                for (std::size_t Entry = 0; Entry < Baked.Items.size(); ++Entry) {
+                    const Rectangle& Bounds{Baked.Bounds[Entry]};
+                    Entries.push_back(GridEntry{Indexes->GridProps[Index][Entry], Bounds.x, Bounds.y, Bounds.width, Bounds.height});
+                }
+
+                std::vector<std::uint32_t> Starts{0};
+                std::vector<std::uint32_t> Links{};
+                for (auto& Cell:Baked.Cells) {
+                    Links.insert(Links.end(), Cell.begin(), Cell.end());
+                    Starts.push_back(static_cast<std::uint32_t>(Links.size()));
+                }
+
+                Grid.EntryCount = static_cast<std::uint32_t>(Entries.size());
+                Grid.EntryOffset = Append(Out, Entries.data(), Entries.size());
+                Grid.CellOffset = Append(Out, Starts.data(), Starts.size());
+                Grid.LinkCount = static_cast<std::uint32_t>(Links.size());
+                Grid.LinkOffset = Append(Out, Links.data(), Links.size());
+            }
+            std::memcpy(Out.data() + Head.GridOffset, Grids.data(), Grids.size() * sizeof(GridRecord));
+
+            // The record is a multiple of 8 bytes, so the words after it stay aligned
+            const CollisionMask& Source{*Indexes->Mask};
+            MaskRecord Mask{};
+            Mask.CellSize = static_cast<std::uint32_t>(Source.GetCellSize());
+            Mask.Columns = static_cast<std::uint32_t>(Source.GetColumns());
+            Mask.Rows = static_cast<std::uint32_t>(Source.GetRows());
+            Mask.WordCount = static_cast<std::uint32_t>(Source.GetBits().size());
+
+            Align(Out, 8);
+            Head.MaskOffset = static_cast<std::uint32_t>(Out.size());
+            Mask.WordOffset = Head.MaskOffset + sizeof(MaskRecord);
+            Append(Out, &Mask, 1);
+            Append(Out, Source.GetBits().data(), Source.GetBits().size());
+        }
+
+        std::memcpy(Out.data(), &Head, sizeof(Header));
+        return Out;
+    }
+
+    bool WriteFile(const std::string& Path, const std::vector<unsigned char>& Data)
+    {
+        std::ofstream Output{Path, std::ios::binary | std::ios::trunc};
+        Output.write(reinterpret_cast<const char*>(Data.data()), static_cast<std::streamsize>(Data.size()));
+        if (!Output) {
+            std::fprintf(stderr, "levelc: cannot write %s\n", Path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // Builds the props from the records just written, the way the game does, and lets
+    // Props::BuildGrids index them. Grid entries are then stored as record indexes.
+    bool BakeIndexes(const std::string& Path, LevelSource& Level, const GameTexture& Textures)
+    {
+        using namespace LevelFormat;
+
+        GameAudio Audio;
+        Background Map{Textures, Audio};
+        BakedIndexes Indexes{};
+        Indexes.WorldSize = Map.GetForestMapSize();
+
+        // The file is rewritten below, so it is only mapped while the props are built
+        Props Container{{}, {}};
+        std::vector<Prop> Trees{};
+        std::vector<Prop*> Mapped{};
+        {
+            LevelFile File{Path, Textures};
+            if (!File.IsLoaded()) {
+                return false;
+            }
+
+            auto TreeGroups{File.LoadProps(PropLayer::TREES, Textures, Audio)};
+            Trees = TreeGroups.empty() ? std::vector<Prop>{} : std::move(TreeGroups.front());
+            Container.Under = File.LoadProps(PropLayer::UNDER, Textures, Audio);
+            Container.Over = File.LoadProps(PropLayer::OVER, Textures, Audio);
+            Mapped = File.MapProps(Container, Trees);
+        }
+
+        Container.BuildGrids(Trees, Indexes.WorldSize);
+
+        std::unordered_map<const Prop*, std::uint32_t> Records{};
+        for (std::size_t Index = 0; Index < Mapped.size(); ++Index) {
+            if (Mapped[Index]) {
+                Records[Mapped[Index]] = static_cast<std::uint32_t>(Index);
+            }
+        }
+
+        Indexes.Grids.emplace_back(GridKind::UNDER_COLLISION, Container.UnderGrid.Export());
+        Indexes.Grids.emplace_back(GridKind::OVER_COLLISION, Container.OverGrid.Export());
+        Indexes.Grids.emplace_back(GridKind::UNDER_VISIBLE, Container.UnderVisible.Export());
+        Indexes.Grids.emplace_back(GridKind::OVER_VISIBLE, Container.OverVisible.Export());
+        Indexes.Grids.emplace_back(GridKind::TREE_VISIBLE, Container.TreeVisible.Export());
+        Indexes.Grids.emplace_back(GridKind::STATIC_COLLISION, Container.StaticGrid.Export());
+        Indexes.Mask = &Container.StaticMask;
+
+        Indexes.GridProps.resize(Indexes.Grids.size());
+        for (std::size_t Grid = 0; Grid < Indexes.Grids.size(); ++Grid) {
+            for (auto Item:Indexes.Grids[Grid].second.Items) {
+                Indexes.GridProps[Grid].push_back(Records.at(Item));
+            }
+        }
+
+        return WriteFile(Path, Serialize(Level, &Indexes));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: levelc <source.level> <output.lvl>\n");
+        return EXIT_FAILURE;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // The props only need image sizes, so run headless like the bench: no audio device and no sounds decoded
+    Platform::SetHeadless(1280, 720, 1.f/144.f);
+
+    // Image paths and sizes only, the pixels are never decoded
+    GameTexture Textures;
+
+    LevelSource Level{};
+    if (!ParseSource(argv[1], Textures.Atlas, Level)) {
+        return EXIT_FAILURE;
+    }
+
+    // The records go out first so the game's loader can build the props the indexes are made of
+    if (!WriteFile(argv[2], Serialize(Level, nullptr)) || !BakeIndexes(argv[2], Level, Textures)) {
+        std::fprintf(stderr, "levelc: failed to bake %s\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("levelc: %s -> %s (%zu props, %zu enemies)\n", argv[1], argv[2], Level.Props.size(), Level.Enemies.size());
+    return EXIT_SUCCESS;
+}